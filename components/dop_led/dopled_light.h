@@ -80,6 +80,7 @@ class DoPLEDOutput : public light::AddressableLight {
   uint8_t num_header_bits_{0};
   uint8_t num_leds_{0};
   uint32_t last_refresh_{0};
+  uint32_t last_frame_duration_{0};
   optional<uint32_t> max_refresh_rate_{};
   remote_transmitter::RemoteTransmitterComponent *transmitter_{nullptr};
   remote_transmitter::RemoteTransmitterComponent::TransmitCall transmit_call_;
@@ -9,6 +9,10 @@ static const char *const TAG = "dop_led_plus_h_bridge";
 void DoPLEDOutput::setup() {
   ESP_LOGCONFIG(TAG, "Setting up DoPLED light...");
   this->effect_data_ = new uint8_t[this->num_leds_];  // NOLINT
+#ifdef USE_ESP32
+  // frames are looped, so they have to fit the transmitter's RMT memory in one piece
+  this->transmitter_->set_max_frame_items(((8 * 3) + this->num_header_bits_ + 1) * this->num_leds_);
+#endif
 }
 
 void DoPLEDOutput::dump_config() {
@@ -39,12 +43,12 @@ void DoPLEDOutput::write_state(light::LightState *state) {
         }
 
         // protect from refreshing too often
-        if (this->max_refresh_rate_.has_value()) {
-          if (this->max_refresh_rate_.value() != 0 && (now - this->last_refresh_) < this->max_refresh_rate_.value()) {
-            // try again next loop iteration, so that this change won't get lost
-            this->schedule_show();
-            return;
-          }
+        // (without a configured rate, wait until the previous frame has been fully sent at least once)
+        const uint32_t min_interval = this->max_refresh_rate_.value_or(this->last_frame_duration_);
+        if (min_interval != 0 && (now - this->last_refresh_) < min_interval) {
+          // try again next loop iteration, so that this change won't get lost
+          this->schedule_show();
+          return;
         }
 
         if (this->transmitter_ == nullptr) {
@@ -54,6 +58,7 @@ void DoPLEDOutput::write_state(light::LightState *state) {
           this->transmit_call_->get_data()->reset();
           remote_base::DoPLEDData xmit_data{this->num_header_bits_, this->num_leds_, this->order_, this->leds_};
           remote_base::DoPLEDProtocol().encode(this->transmit_call_->get_data(), xmit_data);
+          this->last_frame_duration_ = this->transmit_call_->get_data()->get_duration();
           this->transmit_call_->set_send_times(0);
           this->transmit_call_->perform();
         }
@@ -96,6 +96,7 @@ class DoPLEDOutput : public light::AddressableLight {
   uint8_t num_header_bits_{0};
   uint8_t num_leds_{0};
   uint32_t last_refresh_{0};
+  uint32_t last_frame_duration_{0};
   optional<uint32_t> max_refresh_rate_{};
   light::ColorMode prev_color_mode_{};
   remote_transmitter::RemoteTransmitterComponent::TransmitCall *transmit_call_{nullptr};
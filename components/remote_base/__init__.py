@@ -4,6 +4,7 @@ from esphome import automation
 from esphome.components import binary_sensor
 from esphome.const import (
     CONF_DATA,
+    CONF_ID,
     CONF_TRIGGER_ID,
     CONF_NBITS,
     CONF_ADDRESS,
@@ -14,6 +15,8 @@ from esphome.const import (
     CONF_ZERO,
     CONF_ONE,
     CONF_INVERTED,
+    CONF_PLATFORM,
+    CONF_PRIORITY,
     CONF_PROTOCOL,
     CONF_GROUP,
     CONF_DEVICE,
@@ -24,6 +27,7 @@ from esphome.const import (
     CONF_REPEAT,
     CONF_WAIT_TIME,
     CONF_TIMES,
+    CONF_TOLERANCE,
     CONF_TYPE_ID,
     CONF_CARRIER_FREQUENCY,
     CONF_RC_CODE_1,
@@ -32,19 +36,65 @@ from esphome.const import (
     CONF_WAND_ID,
     CONF_LEVEL,
 )
-from esphome.core import coroutine
+from esphome.core import CORE, ID, coroutine, coroutine_with_priority
 from esphome.schema_extractors import SCHEMA_EXTRACT, schema_extractor
 from esphome.util import Registry, SimpleRegistry
 
+from . import encoding
+
 AUTO_LOAD = ["binary_sensor"]
 
 CONF_RECEIVER_ID = "receiver_id"
+CONF_DEFERRED_DUMPS = "deferred_dumps"
+CONF_MAX_FRAMES = "max_frames"
+CONF_SUPPRESS_REPEATS = "suppress_repeats"
 CONF_TRANSMITTER_ID = "transmitter_id"
 CONF_FIRST = "first"
+CONF_ACTION = "action"
+CONF_FRAMES = "frames"
+CONF_GAP = "gap"
+CONF_MAX_INLINE_GAP = "max_inline_gap"
+CONF_COALESCE_KEY = "coalesce_key"
+CONF_PROFILING = "profiling"
+CONF_ITERATIONS = "iterations"
+CONF_NOISE_FRAMES = "noise_frames"
+CONF_PROTOCOLS = "protocols"
+CONF_GLITCH_PROBABILITY = "glitch_probability"
+CONF_JITTER = "jitter"
+CONF_TOLERANCES = "tolerances"
+CONF_RECEIVERS = "receivers"
+CONF_DETECT_CARRIER = "detect_carrier"
+CONF_GLITCH_THRESHOLD = "glitch_threshold"
+CONF_MIN_FRAME_TIMINGS = "min_frame_timings"
+CONF_MAX_DISTINCT_TIMINGS = "max_distinct_timings"
+CONF_SEGMENT_GAP = "segment_gap"
+CONF_EXCLUSIVE_LISTENERS = "exclusive_listeners"
+CONF_FINGERPRINT_TIMEOUT = "fingerprint_timeout"
+
+# Registry names that are implemented in another protocol's source file
+PROTOCOL_ALIASES = {
+    "canalsatld": "canalsat",
+    "rc_switch_raw": "rc_switch",
+    "rc_switch_type_a": "rc_switch",
+    "rc_switch_type_b": "rc_switch",
+    "rc_switch_type_c": "rc_switch",
+    "rc_switch_type_d": "rc_switch",
+}
+# Integrations that use protocol classes directly from C++
+PROTOCOL_USERS = {
+    "coolix": ["coolix"],
+    "midea_ir": ["midea"],
+}
 
 ns = remote_base_ns = cg.esphome_ns.namespace("remote_base")
 RemoteProtocol = ns.class_("RemoteProtocol")
 RemoteReceiverListener = ns.class_("RemoteReceiverListener")
+RemoteReceiverProfiler = ns.class_("RemoteReceiverProfiler", cg.PollingComponent)
+RemoteDumpQueue = ns.class_("RemoteDumpQueue", cg.Component)
+RemoteBenchmarkAction = ns.class_("RemoteBenchmarkAction", automation.Action)
+RemoteRoundTripAction = ns.class_("RemoteRoundTripAction", automation.Action)
+RemoteReceiverDispatcher = ns.class_("RemoteReceiverDispatcher", RemoteReceiverListener)
+RemoteReceiverDispatch = ns.class_("RemoteReceiverDispatch", RemoteReceiverListener)
 RemoteReceiverBinarySensorBase = ns.class_(
     "RemoteReceiverBinarySensorBase", binary_sensor.BinarySensor, cg.Component
 )
@@ -55,6 +105,9 @@ RemoteTransmitterDumper = ns.class_("RemoteTransmitterDumper")
 RemoteTransmitterActionBase = ns.class_(
     "RemoteTransmitterActionBase", automation.Action
 )
+RemoteTransmitterMacroAction = ns.class_(
+    "RemoteTransmitterMacroAction", automation.Action, cg.Component
+)
 RemoteReceiverBase = ns.class_("RemoteReceiverBase")
 RemoteTransmitterBase = ns.class_("RemoteTransmitterBase")
 
@@ -68,13 +121,104 @@ def templatize(value):
     return cv.Schema(ret)
 
 
+# Protocol sources are only compiled in when something in the config asks for them
+def request_protocol(name):
+    name = PROTOCOL_ALIASES.get(name, name)
+    cg.add_define(f"USE_REMOTE_PROTOCOL_{name.upper()}")
+
+
+# Decode profiling is on when configured on remote_base or when a profile sensor uses it
+def profiling_enabled():
+    if CONF_PROFILING in CORE.config.get("remote_base", {}):
+        return True
+    sensors = CORE.config.get("sensor", [])
+    return any(conf.get(CONF_PLATFORM) == "remote_base" for conf in sensors)
+
+
+def set_profile_name(var, name):
+    if profiling_enabled():
+        cg.add(var.set_profile_name(name))
+
+
+# Frame processing options of a receiver; a receiver platform can extend its schema
+# with these and call setup_receiver_options(), or they're set per receiver under
+# remote_base's receivers
+RECEIVER_OPTIONS_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_CARRIER_FREQUENCY): cv.All(cv.frequency, cv.int_),
+        cv.Optional(CONF_DETECT_CARRIER): cv.boolean,
+        cv.Optional(CONF_GLITCH_THRESHOLD): cv.positive_time_period_microseconds,
+        cv.Optional(CONF_MIN_FRAME_TIMINGS): cv.positive_int,
+        cv.Optional(CONF_MAX_DISTINCT_TIMINGS): cv.int_range(min=0, max=32),
+        cv.Optional(CONF_SEGMENT_GAP): cv.positive_time_period_microseconds,
+        cv.Optional(CONF_EXCLUSIVE_LISTENERS): cv.boolean,
+        cv.Optional(CONF_FINGERPRINT_TIMEOUT): cv.positive_time_period_milliseconds,
+    }
+)
+
+
+async def setup_receiver_options(var, config):
+    if CONF_CARRIER_FREQUENCY in config:
+        cg.add(var.set_carrier_frequency(config[CONF_CARRIER_FREQUENCY]))
+    if CONF_DETECT_CARRIER in config:
+        cg.add(var.set_detect_carrier(config[CONF_DETECT_CARRIER]))
+    if CONF_GLITCH_THRESHOLD in config:
+        cg.add(var.set_glitch_threshold(config[CONF_GLITCH_THRESHOLD]))
+    if CONF_MIN_FRAME_TIMINGS in config:
+        cg.add(var.set_min_frame_timings(config[CONF_MIN_FRAME_TIMINGS]))
+    if CONF_MAX_DISTINCT_TIMINGS in config:
+        cg.add(var.set_max_distinct_timings(config[CONF_MAX_DISTINCT_TIMINGS]))
+    if CONF_SEGMENT_GAP in config:
+        cg.add(var.set_segment_gap(config[CONF_SEGMENT_GAP]))
+    if CONF_EXCLUSIVE_LISTENERS in config:
+        cg.add(var.set_exclusive_listeners(config[CONF_EXCLUSIVE_LISTENERS]))
+    if CONF_FINGERPRINT_TIMEOUT in config:
+        cg.add(var.set_fingerprint_timeout(config[CONF_FINGERPRINT_TIMEOUT]))
+
+
+# suppress_repeats needs the fingerprint cache of its receiver, which gets this
+# timeout (in ms) unless its options set one
+DEFAULT_FINGERPRINT_TIMEOUT = 250
+DATA_FINGERPRINT_RECEIVERS = "remote_base_fingerprint_receivers"
+
+
+def receiver_options(receiver_id):
+    for conf in CORE.config.get("remote_base", {}).get(CONF_RECEIVERS, []):
+        if conf[CONF_RECEIVER_ID].id == receiver_id.id:
+            return conf
+    for conf in CORE.config.get("remote_receiver", []):
+        if conf[CONF_ID].id == receiver_id.id:
+            return conf
+    return {}
+
+
+async def enable_fingerprint_cache(receiver_id):
+    if CONF_FINGERPRINT_TIMEOUT in receiver_options(receiver_id):
+        return
+    enabled = CORE.data.setdefault(DATA_FINGERPRINT_RECEIVERS, set())
+    if receiver_id.id in enabled:
+        return
+    enabled.add(receiver_id.id)
+    receiver = await cg.get_variable(receiver_id)
+    cg.add(receiver.set_fingerprint_timeout(DEFAULT_FINGERPRINT_TIMEOUT))
+
+
 async def register_listener(var, config):
     receiver = await cg.get_variable(config[CONF_RECEIVER_ID])
     cg.add(receiver.register_listener(var))
 
 
 def register_binary_sensor(name, type, schema):
-    return BINARY_SENSOR_REGISTRY.register(name, type, schema)
+    registerer = BINARY_SENSOR_REGISTRY.register(name, type, schema)
+
+    def decorator(func):
+        async def new_func(var, config):
+            request_protocol(name)
+            await coroutine(func)(var, config)
+
+        return registerer(new_func)
+
+    return decorator
 
 
 def register_trigger(name, type, data_type):
@@ -90,9 +234,12 @@ def register_trigger(name, type, data_type):
 
     def decorator(func):
         async def new_func(config):
+            request_protocol(name)
             var = cg.new_Pvariable(config[CONF_TRIGGER_ID])
             await coroutine(func)(var, config)
-            await automation.build_automation(var, [(data_type, "x")], config)
+            # the decoded data is passed by reference, so triggering copies nothing
+            data_ref = data_type.operator("ref").operator("const")
+            await automation.build_automation(var, [(data_ref, "x")], config)
             return var
 
         return registerer(new_func)
@@ -105,7 +252,9 @@ def register_dumper(name, type):
 
     def decorator(func):
         async def new_func(config, dumper_id):
+            request_protocol(name)
             var = cg.new_Pvariable(dumper_id)
+            set_profile_name(var, name)
             await coroutine(func)(var, config)
             return var
 
@@ -131,11 +280,29 @@ BASE_REMOTE_TRANSMITTER_SCHEMA = cv.Schema(
     {
         cv.GenerateID(CONF_TRANSMITTER_ID): cv.use_id(RemoteTransmitterBase),
         cv.Optional(CONF_REPEAT): validate_repeat,
+        cv.Optional(CONF_COALESCE_KEY): cv.string_strict,
+        cv.Optional(CONF_PRIORITY): cv.uint8_t,
     }
 )
 
+# Options of every transmit action that do not go into the encoded frame
+TRANSMIT_OPTIONS = (CONF_TRANSMITTER_ID, CONF_REPEAT, CONF_COALESCE_KEY, CONF_PRIORITY)
+
 
-def register_action(name, type_, schema):
+# 32-bit FNV-1a hash of a coalesce key; 0 means "not coalesced" and is never returned
+def coalesce_key_hash(key):
+    value = 0x811C9DC5
+    for byte in key.encode("utf-8"):
+        value = ((value ^ byte) * 0x01000193) & 0xFFFFFFFF
+    return value or 1
+
+
+# Transmit actions whose values are all constant don't encode their frame on every
+# send: with a static_encoder (config -> (carrier_frequency, timings), see encoding.py)
+# the frame is encoded here and stored in flash, otherwise it's encoded on the first
+# send and kept on the heap. Actions that change their frame from send to send (RC5
+# and RC6 toggle a bit) or that send from flash already set cache_encoding=False.
+def register_action(name, type_, schema, cache_encoding=True, static_encoder=None):
     validator = templatize(schema).extend(BASE_REMOTE_TRANSMITTER_SCHEMA)
     registerer = automation.register_action(
         f"remote_transmitter.transmit_{name}", type_, validator
@@ -143,6 +310,7 @@ def register_action(name, type_, schema):
 
     def decorator(func):
         async def new_func(config, action_id, template_arg, args):
+            request_protocol(name)
             transmitter = await cg.get_variable(config[CONF_TRANSMITTER_ID])
             var = cg.new_Pvariable(action_id, template_arg)
             cg.add(var.set_parent(transmitter))
@@ -152,7 +320,27 @@ def register_action(name, type_, schema):
                 cg.add(var.set_send_times(template_))
                 template_ = await cg.templatable(conf[CONF_WAIT_TIME], args, cg.uint32)
                 cg.add(var.set_send_wait(template_))
+            if CONF_COALESCE_KEY in config:
+                key_hash = coalesce_key_hash(config[CONF_COALESCE_KEY])
+                cg.add(var.set_coalesce_key(key_hash))
+            if CONF_PRIORITY in config:
+                cg.add(var.set_priority(config[CONF_PRIORITY]))
+            constant = not any(
+                cg.is_template(value)
+                for key, value in config.items()
+                if key not in TRANSMIT_OPTIONS
+            )
+            if constant and static_encoder is not None:
+                carrier_frequency, timings = static_encoder(config)
+                timings_id = ID(
+                    f"{action_id.id}_timings", is_declaration=True, type=cg.int32
+                )
+                arr = cg.progmem_array(timings_id, timings)
+                cg.add(var.set_static_timings(arr, len(timings), carrier_frequency))
+                return var
             await coroutine(func)(var, config, args)
+            if constant and cache_encoding:
+                cg.add(var.set_static_encoding(True))
             return var
 
         return registerer(new_func)
@@ -160,19 +348,86 @@ def register_action(name, type_, schema):
     return decorator
 
 
-def declare_protocol(name):
+# Binary sensor and trigger types that share one decode per receiver, mapped to the
+# name and dispatcher of their protocol
+DISPATCHED_TYPES = {}
+DATA_DISPATCH = "remote_base_dispatch"
+
+
+def declare_protocol(name, dispatch=True):
     data = ns.struct(f"{name}Data")
     binary_sensor_ = ns.class_(f"{name}BinarySensor", RemoteReceiverBinarySensorBase)
     trigger = ns.class_(f"{name}Trigger", RemoteReceiverTrigger)
     action = ns.class_(f"{name}Action", RemoteTransmitterActionBase)
     dumper = ns.class_(f"{name}Dumper", RemoteTransmitterDumper)
+    if dispatch:
+        dispatcher = ns.class_(f"{name}Dispatcher", RemoteReceiverDispatcher)
+        DISPATCHED_TYPES[str(binary_sensor_)] = (name.lower(), dispatcher)
+        DISPATCHED_TYPES[str(trigger)] = (name.lower(), dispatcher)
     return data, binary_sensor_, trigger, action, dumper
 
 
+# Leave var, a binary sensor or trigger of type_, to the dispatcher of its protocol on
+# the receiver; False if type_ is not dispatched. kind is "binary_sensors" or
+# "triggers". The dispatchers are generated once all of them are known.
+def add_to_dispatch(receiver_id, var, type_, kind, profile_name):
+    if str(type_) not in DISPATCHED_TYPES:
+        return False
+    name, dispatcher_type = DISPATCHED_TYPES[str(type_)]
+    if DATA_DISPATCH not in CORE.data:
+        CORE.data[DATA_DISPATCH] = {}
+        CORE.add_job(generate_dispatch)
+    receiver = CORE.data[DATA_DISPATCH].setdefault(
+        receiver_id.id, {CONF_RECEIVER_ID: receiver_id, "protocols": {}}
+    )
+    protocol = receiver["protocols"].setdefault(
+        name,
+        {
+            "type": dispatcher_type,
+            "profile_name": profile_name,
+            "binary_sensors": [],
+            "triggers": [],
+        },
+    )
+    protocol[kind].append(var)
+    return True
+
+
+# One RemoteReceiverDispatch per receiver, holding a dispatcher for each protocol its
+# binary sensors and triggers use, sized for exactly those. Runs after the rest of
+# the code generation, when every binary sensor and trigger has been added.
+@coroutine_with_priority(-100.0)
+async def generate_dispatch():
+    for receiver_name, receiver in CORE.data[DATA_DISPATCH].items():
+        protocols = list(receiver["protocols"].values())
+        types = [
+            protocol["type"].template(
+                len(protocol["binary_sensors"]), len(protocol["triggers"])
+            )
+            for protocol in protocols
+        ]
+        dispatch_id = ID(
+            f"{receiver_name}_dispatch",
+            is_declaration=True,
+            type=RemoteReceiverDispatch.template(*types),
+        )
+        dispatch = cg.new_Pvariable(dispatch_id)
+        for index, protocol in enumerate(protocols):
+            dispatcher = cg.MockObj(f"{dispatch}->get<{index}>()", "->")
+            for var in protocol["binary_sensors"]:
+                cg.add(dispatcher.add_binary_sensor(var))
+            for var in protocol["triggers"]:
+                cg.add(dispatcher.add_trigger(var))
+            set_profile_name(dispatcher, protocol["profile_name"])
+        parent = await cg.get_variable(receiver[CONF_RECEIVER_ID])
+        cg.add(parent.register_listener(dispatch))
+
+
 BINARY_SENSOR_REGISTRY = Registry(
     binary_sensor.binary_sensor_schema().extend(
         {
             cv.GenerateID(CONF_RECEIVER_ID): cv.use_id(RemoteReceiverBase),
+            cv.Optional(CONF_SUPPRESS_REPEATS, default=False): cv.boolean,
         }
     )
 )
@@ -220,7 +475,18 @@ async def build_binary_sensor(full_config):
     builder = registry_entry.coroutine_fun
     var = cg.new_Pvariable(type_id)
     await cg.register_component(var, full_config)
-    await register_listener(var, full_config)
+    if full_config[CONF_SUPPRESS_REPEATS]:
+        cg.add(var.set_suppress_repeats(True))
+        await enable_fingerprint_cache(full_config[CONF_RECEIVER_ID])
+    if not add_to_dispatch(
+        full_config[CONF_RECEIVER_ID],
+        var,
+        type_id.type,
+        "binary_sensors",
+        registry_entry.name,
+    ):
+        await register_listener(var, full_config)
+        set_profile_name(var, registry_entry.name)
     await builder(var, config)
     return var
 
@@ -230,7 +496,14 @@ async def build_triggers(full_config):
     for key in TRIGGER_REGISTRY:
         for config in full_config.get(key, []):
             func = TRIGGER_REGISTRY[key][0]
-            triggers.append(await func(config))
+            trigger = await func(config)
+            name = key[len("on_") :]
+            type_ = config[CONF_TRIGGER_ID].type
+            if not add_to_dispatch(
+                full_config[CONF_ID], trigger, type_, "triggers", name
+            ):
+                triggers.append(trigger)
+                set_profile_name(trigger, name)
     return triggers
 
 
@@ -242,6 +515,53 @@ async def build_dumpers(config):
     return dumpers
 
 
+def validate_macro_frame_action(value):
+    value = automation.validate_action(value)
+    name = next(key for key in value if key != CONF_TYPE_ID)
+    if (
+        not name.startswith("remote_transmitter.transmit_")
+        or name == "remote_transmitter.transmit_macro"
+    ):
+        raise cv.Invalid(
+            f"Macro frames must be remote_transmitter.transmit_ actions, got '{name}'"
+        )
+    return value
+
+
+@automation.register_action(
+    "remote_transmitter.transmit_macro",
+    RemoteTransmitterMacroAction,
+    cv.Schema(
+        {
+            cv.GenerateID(CONF_TRANSMITTER_ID): cv.use_id(RemoteTransmitterBase),
+            cv.Optional(
+                CONF_MAX_INLINE_GAP, default="50ms"
+            ): cv.positive_time_period_microseconds,
+            cv.Required(CONF_FRAMES): cv.ensure_list(
+                cv.Schema(
+                    {
+                        cv.Required(CONF_ACTION): validate_macro_frame_action,
+                        cv.Optional(
+                            CONF_GAP, default="0ms"
+                        ): cv.positive_time_period_microseconds,
+                    }
+                )
+            ),
+        }
+    ),
+)
+async def transmit_macro_action(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_component(var, {})
+    transmitter = await cg.get_variable(config[CONF_TRANSMITTER_ID])
+    cg.add(var.set_parent(transmitter))
+    cg.add(var.set_max_inline_gap(config[CONF_MAX_INLINE_GAP]))
+    for frame in config[CONF_FRAMES]:
+        action = await automation.build_action(frame[CONF_ACTION], template_arg, args)
+        cg.add(var.add_frame(action, frame[CONF_GAP]))
+    return var
+
+
 # CanalSat
 (
     CanalSatData,
@@ -435,7 +755,14 @@ def dish_dumper(var, config):
     pass
 
 
-@register_action("dish", DishAction, DISH_SCHEMA)
+@register_action(
+    "dish",
+    DishAction,
+    DISH_SCHEMA,
+    static_encoder=lambda config: encoding.dish(
+        config[CONF_ADDRESS], config[CONF_COMMAND]
+    ),
+)
 async def dish_action(var, config, args):
     template_ = await cg.templatable(config[CONF_ADDRESS], args, cg.uint8)
     cg.add(var.set_address(template_))
@@ -470,7 +797,12 @@ def jvc_dumper(var, config):
     pass
 
 
-@register_action("jvc", JVCAction, JVC_SCHEMA)
+@register_action(
+    "jvc",
+    JVCAction,
+    JVC_SCHEMA,
+    static_encoder=lambda config: encoding.jvc(config[CONF_DATA]),
+)
 async def jvc_action(var, config, args):
     template_ = await cg.templatable(config[CONF_DATA], args, cg.uint32)
     cg.add(var.set_data(template_))
@@ -509,7 +841,12 @@ def lg_dumper(var, config):
     pass
 
 
-@register_action("lg", LGAction, LG_SCHEMA)
+@register_action(
+    "lg",
+    LGAction,
+    LG_SCHEMA,
+    static_encoder=lambda config: encoding.lg(config[CONF_DATA], config[CONF_NBITS]),
+)
 async def lg_action(var, config, args):
     template_ = await cg.templatable(config[CONF_DATA], args, cg.uint32)
     cg.add(var.set_data(template_))
@@ -598,7 +935,14 @@ def nec_dumper(var, config):
     pass
 
 
-@register_action("nec", NECAction, NEC_SCHEMA)
+@register_action(
+    "nec",
+    NECAction,
+    NEC_SCHEMA,
+    static_encoder=lambda config: encoding.nec(
+        config[CONF_ADDRESS], config[CONF_COMMAND]
+    ),
+)
 async def nec_action(var, config, args):
     template_ = await cg.templatable(config[CONF_ADDRESS], args, cg.uint16)
     cg.add(var.set_address(template_))
@@ -645,7 +989,14 @@ def pioneer_dumper(var, config):
     pass
 
 
-@register_action("pioneer", PioneerAction, PIONEER_SCHEMA)
+@register_action(
+    "pioneer",
+    PioneerAction,
+    PIONEER_SCHEMA,
+    static_encoder=lambda config: encoding.pioneer(
+        config[CONF_RC_CODE_1], config[CONF_RC_CODE_2]
+    ),
+)
 async def pioneer_action(var, config, args):
     template_ = await cg.templatable(config[CONF_RC_CODE_1], args, cg.uint16)
     cg.add(var.set_rc_code_1(template_))
@@ -731,7 +1082,12 @@ def sony_dumper(var, config):
     pass
 
 
-@register_action("sony", SonyAction, SONY_SCHEMA)
+@register_action(
+    "sony",
+    SonyAction,
+    SONY_SCHEMA,
+    static_encoder=lambda config: encoding.sony(config[CONF_DATA], config[CONF_NBITS]),
+)
 async def sony_action(var, config, args):
     template_ = await cg.templatable(config[CONF_DATA], args, cg.uint32)
     cg.add(var.set_data(template_))
@@ -755,7 +1111,13 @@ def validate_raw_alternating(value):
     return value
 
 
-RawData, RawBinarySensor, RawTrigger, RawAction, RawDumper = declare_protocol("Raw")
+(
+    RawData,
+    RawBinarySensor,
+    RawTrigger,
+    RawAction,
+    RawDumper,
+) = declare_protocol("Raw", dispatch=False)
 CONF_CODE_STORAGE_ID = "code_storage_id"
 RAW_SCHEMA = cv.Schema(
     {
@@ -797,6 +1159,7 @@ def raw_dumper(var, config):
             ),
         }
     ),
+    cache_encoding=False,
 )
 async def raw_action(var, config, args):
     code_ = config[CONF_CODE]
@@ -895,7 +1258,7 @@ def rc5_dumper(var, config):
     pass
 
 
-@register_action("rc5", RC5Action, RC5_SCHEMA)
+@register_action("rc5", RC5Action, RC5_SCHEMA, cache_encoding=False)
 async def rc5_action(var, config, args):
     template_ = await cg.templatable(config[CONF_ADDRESS], args, cg.uint8)
     cg.add(var.set_address(template_))
@@ -938,7 +1301,7 @@ def rc6_dumper(var, config):
     pass
 
 
-@register_action("rc6", RC6Action, RC6_SCHEMA)
+@register_action("rc6", RC6Action, RC6_SCHEMA, cache_encoding=False)
 async def rc6_action(var, config, args):
     template_ = await cg.templatable(config[CONF_ADDRESS], args, cg.uint8)
     cg.add(var.set_address(template_))
@@ -1275,7 +1638,14 @@ def samsung_dumper(var, config):
     pass
 
 
-@register_action("samsung", SamsungAction, SAMSUNG_SCHEMA)
+@register_action(
+    "samsung",
+    SamsungAction,
+    SAMSUNG_SCHEMA,
+    static_encoder=lambda config: encoding.samsung(
+        config[CONF_DATA], config[CONF_NBITS]
+    ),
+)
 async def samsung_action(var, config, args):
     template_ = await cg.templatable(config[CONF_DATA], args, cg.uint64)
     cg.add(var.set_data(template_))
@@ -1322,7 +1692,14 @@ def samsung36_dumper(var, config):
     pass
 
 
-@register_action("samsung36", Samsung36Action, SAMSUNG36_SCHEMA)
+@register_action(
+    "samsung36",
+    Samsung36Action,
+    SAMSUNG36_SCHEMA,
+    static_encoder=lambda config: encoding.samsung36(
+        config[CONF_ADDRESS], config[CONF_COMMAND]
+    ),
+)
 async def samsung36_action(var, config, args):
     template_ = await cg.templatable(config[CONF_ADDRESS], args, cg.uint16)
     cg.add(var.set_address(template_))
@@ -1369,7 +1746,14 @@ def toshibaac_dumper(var, config):
     pass
 
 
-@register_action("toshiba_ac", ToshibaAcAction, TOSHIBAAC_SCHEMA)
+@register_action(
+    "toshiba_ac",
+    ToshibaAcAction,
+    TOSHIBAAC_SCHEMA,
+    static_encoder=lambda config: encoding.toshiba_ac(
+        config[CONF_RC_CODE_1], config[CONF_RC_CODE_2]
+    ),
+)
 async def toshibaac_action(var, config, args):
     template_ = await cg.templatable(config[CONF_RC_CODE_1], args, cg.uint64)
     cg.add(var.set_rc_code_1(template_))
@@ -1416,7 +1800,14 @@ def panasonic_dumper(var, config):
     pass
 
 
-@register_action("panasonic", PanasonicAction, PANASONIC_SCHEMA)
+@register_action(
+    "panasonic",
+    PanasonicAction,
+    PANASONIC_SCHEMA,
+    static_encoder=lambda config: encoding.panasonic(
+        config[CONF_ADDRESS], config[CONF_COMMAND]
+    ),
+)
 async def panasonic_action(var, config, args):
     template_ = await cg.templatable(config[CONF_ADDRESS], args, cg.uint16)
     cg.add(var.set_address(template_))
@@ -1569,7 +1960,14 @@ HAIER_SCHEMA = cv.Schema(
 
 @register_binary_sensor("haier", HaierBinarySensor, HAIER_SCHEMA)
 def haier_binary_sensor(var, config):
-    cg.add(var.set_code(config[CONF_CODE]))
+    cg.add(
+        var.set_data(
+            cg.StructInitializer(
+                HaierData,
+                ("data", config[CONF_CODE]),
+            )
+        )
+    )
 
 
 @register_trigger("haier", HaierTrigger, HaierData)
@@ -1619,3 +2017,165 @@ def hsl_dumper(var, config):
 async def hsl_action(var, config, args):
     template_ = await cg.templatable(config[CONF_DATA], args, cg.uint32)
     cg.add(var.set_data(template_))
+
+
+# Dumpers whose decoding does not go through a RemoteProtocol
+BENCHMARK_EXCLUDED = ("raw", "rc_switch")
+# Protocols whose decoded data holds the received timings, so a round trip only
+# gets them back within tolerance
+ROUND_TRIP_LOSSY = ("pronto",)
+# Protocols decoded from the signal of an inverted receiver pin
+ROUND_TRIP_INVERTED = ("honeywell_string_lights",)
+
+
+def benchmark_protocols():
+    return [name for name in DUMPER_REGISTRY if name not in BENCHMARK_EXCLUDED]
+
+
+def validate_benchmark_protocol(value):
+    return cv.one_of(*benchmark_protocols(), lower=True)(value)
+
+
+# The RemoteProtocol class of a dumper's registry name; every dumper is
+# RemoteReceiverDumper<NameProtocol, NameData>, named NameDumper
+def protocol_class(name):
+    dumper = str(DUMPER_REGISTRY[name].type_id)
+    return cg.RawExpression(dumper[: -len("Dumper")] + "Protocol")
+
+
+@automation.register_action(
+    "remote_base.benchmark",
+    RemoteBenchmarkAction,
+    cv.Schema(
+        {
+            cv.Optional(CONF_PROTOCOLS): cv.ensure_list(validate_benchmark_protocol),
+            cv.Optional(CONF_FRAMES, default=[]): cv.ensure_list(RAW_SCHEMA),
+            cv.Optional(CONF_NOISE_FRAMES, default=0): cv.positive_int,
+            cv.Optional(CONF_ITERATIONS, default=10): cv.positive_not_null_int,
+            cv.Optional(CONF_TOLERANCE, default=25): cv.All(
+                cv.percentage_int, cv.Range(min=0)
+            ),
+        }
+    ),
+)
+async def benchmark_action(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    for name in config.get(CONF_PROTOCOLS, benchmark_protocols()):
+        request_protocol(name)
+        cg.add(var.add_protocol.template(protocol_class(name))(name))
+    for frame in config[CONF_FRAMES]:
+        code_ = frame[CONF_CODE]
+        arr = cg.progmem_array(frame[CONF_CODE_STORAGE_ID], code_)
+        cg.add(var.add_frame(arr, len(code_)))
+    cg.add(var.set_noise_frames(config[CONF_NOISE_FRAMES]))
+    cg.add(var.set_iterations(config[CONF_ITERATIONS]))
+    cg.add(var.set_tolerance(config[CONF_TOLERANCE]))
+    return var
+
+
+def round_trip_protocol(config):
+    name = next(key for key in config if key != CONF_TYPE_ID)
+    return name[len("remote_transmitter.transmit_") :]
+
+
+def validate_round_trip_frame(value):
+    value = validate_macro_frame_action(value)
+    if round_trip_protocol(value) not in benchmark_protocols():
+        raise cv.Invalid(f"Frames of '{round_trip_protocol(value)}' can't be decoded")
+    return value
+
+
+@automation.register_action(
+    "remote_base.round_trip",
+    RemoteRoundTripAction,
+    cv.Schema(
+        {
+            cv.Required(CONF_FRAMES): cv.ensure_list(validate_round_trip_frame),
+            cv.Optional(CONF_ITERATIONS, default=100): cv.positive_not_null_int,
+            cv.Optional(CONF_JITTER, default=["0us"]): cv.ensure_list(
+                cv.positive_time_period_microseconds
+            ),
+            cv.Optional(CONF_TOLERANCES, default=[25]): cv.ensure_list(
+                cv.All(cv.percentage_int, cv.Range(min=0))
+            ),
+            cv.Optional(CONF_GLITCH_PROBABILITY, default=0): cv.percentage_int,
+        }
+    ),
+)
+async def round_trip_action(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    for frame in config[CONF_FRAMES]:
+        name = round_trip_protocol(frame)
+        action = await automation.build_action(frame, template_arg, args)
+        cg.add(
+            var.add_frame.template(protocol_class(name))(
+                action,
+                name,
+                name in ROUND_TRIP_LOSSY,
+                name in ROUND_TRIP_INVERTED,
+            )
+        )
+    cg.add(var.set_iterations(config[CONF_ITERATIONS]))
+    for jitter in config[CONF_JITTER]:
+        cg.add(var.add_jitter(jitter))
+    for tolerance in config[CONF_TOLERANCES]:
+        cg.add(var.add_tolerance(tolerance))
+    cg.add(var.set_glitch_probability(config[CONF_GLITCH_PROBABILITY]))
+    return var
+
+
+def validate_unique_receivers(value):
+    ids = [conf[CONF_RECEIVER_ID].id for conf in value]
+    for receiver_id in ids:
+        if ids.count(receiver_id) > 1:
+            raise cv.Invalid(f"Receiver '{receiver_id}' is listed more than once")
+    return value
+
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_PROFILING): cv.Schema(
+            {
+                cv.GenerateID(): cv.declare_id(RemoteReceiverProfiler),
+            }
+        ).extend(cv.polling_component_schema("60s")),
+        cv.Optional(CONF_DEFERRED_DUMPS): cv.Schema(
+            {
+                cv.GenerateID(): cv.declare_id(RemoteDumpQueue),
+                cv.Optional(CONF_MAX_FRAMES, default=4): cv.int_range(min=1, max=32),
+            }
+        ).extend(cv.COMPONENT_SCHEMA),
+        cv.Optional(CONF_RECEIVERS): cv.All(
+            cv.ensure_list(
+                RECEIVER_OPTIONS_SCHEMA.extend(
+                    {
+                        cv.Required(CONF_RECEIVER_ID): cv.use_id(RemoteReceiverBase),
+                    }
+                )
+            ),
+            validate_unique_receivers,
+        ),
+    }
+)
+
+
+async def to_code(config):
+    if profiling_enabled():
+        cg.add_define("USE_REMOTE_RECEIVER_PROFILING")
+    if CONF_PROFILING in config:
+        conf = config[CONF_PROFILING]
+        var = cg.new_Pvariable(conf[CONF_ID])
+        await cg.register_component(var, conf)
+    if CONF_DEFERRED_DUMPS in config:
+        cg.add_define("USE_REMOTE_DEFERRED_DUMPS")
+        conf = config[CONF_DEFERRED_DUMPS]
+        var = cg.new_Pvariable(conf[CONF_ID])
+        await cg.register_component(var, conf)
+        cg.add(var.set_max_frames(conf[CONF_MAX_FRAMES]))
+    for conf in config.get(CONF_RECEIVERS, []):
+        receiver = await cg.get_variable(conf[CONF_RECEIVER_ID])
+        await setup_receiver_options(receiver, conf)
+    for integration, protocols in PROTOCOL_USERS.items():
+        if integration in CORE.loaded_integrations:
+            for protocol in protocols:
+                request_protocol(protocol)
@@ -2,6 +2,8 @@
 #include "esphome/core/log.h"
 #include <cinttypes>
 
+#ifdef USE_REMOTE_PROTOCOL_AEHA
+
 namespace esphome {
 namespace remote_base {
 
@@ -16,6 +18,10 @@ static const uint16_t BIT_ZERO_LOW_US = BITWISE;
 static const uint16_t TRAILER = BITWISE;
 
 void AEHAProtocol::encode(RemoteTransmitData *dst, const AEHAData &data) {
+  if (data.data.overflowed()) {
+    ESP_LOGE(TAG, "Data is longer than %u bytes, not sending", AEHA_MAX_DATA_BYTES);
+    return;
+  }
   dst->set_carrier_frequency(38000);
   dst->reserve(2 + 32 + (data.data.size() * 2) + 1);
 
@@ -59,7 +65,7 @@ optional<AEHAData> AEHAProtocol::decode(RemoteReceiveData src) {
     }
   }
 
-  for (uint8_t pos = 0; pos < 35; pos++) {
+  for (uint8_t pos = 0; pos < AEHA_MAX_DATA_BYTES; pos++) {
     uint8_t data = 0;
     for (uint8_t mask = 1 << 7; mask != 0; mask >>= 1) {
       if (src.expect_item(BIT_HIGH_US, BIT_ONE_LOW_US)) {
@@ -83,21 +89,26 @@ optional<AEHAData> AEHAProtocol::decode(RemoteReceiveData src) {
   return {};
 }
 
-std::string AEHAProtocol::format_data_(const std::vector<uint8_t> &data) {
-  std::string out;
+void AEHAProtocol::format_data_(const AEHAPayload &data, char *buffer) {
+  static const char *const HEX_DIGITS = "0123456789ABCDEF";
   for (uint8_t byte : data) {
-    char buf[6];
-    sprintf(buf, "0x%02X,", byte);
-    out += buf;
+    *buffer++ = '0';
+    *buffer++ = 'x';
+    *buffer++ = HEX_DIGITS[byte >> 4];
+    *buffer++ = HEX_DIGITS[byte & 0x0F];
+    *buffer++ = ',';
   }
-  out.pop_back();
-  return out;
+  // drop the last comma
+  buffer[data.empty() ? 0 : -1] = '\0';
 }
 
 void AEHAProtocol::dump(const AEHAData &data) {
-  auto data_str = format_data_(data.data);
-  ESP_LOGI(TAG, "Received AEHA: address=0x%04X, data=[%s]", data.address, data_str.c_str());
+  char data_str[AEHA_MAX_DATA_BYTES * 5];
+  this->format_data_(data.data, data_str);
+  ESP_LOGI(TAG, "Received AEHA: address=0x%04X, data=[%s]", data.address, data_str);
 }
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif
@@ -2,14 +2,15 @@
 
 #include "remote_base.h"
 
-#include <vector>
-
 namespace esphome {
 namespace remote_base {
 
+static const uint8_t AEHA_MAX_DATA_BYTES = 35;
+using AEHAPayload = StaticVector<uint8_t, AEHA_MAX_DATA_BYTES>;
+
 struct AEHAData {
   uint16_t address;
-  std::vector<uint8_t> data;
+  AEHAPayload data;
 
   bool operator==(const AEHAData &rhs) const { return address == rhs.address && data == rhs.data; }
 };
@@ -21,7 +22,8 @@ class AEHAProtocol : public RemoteProtocol<AEHAData> {
   void dump(const AEHAData &data) override;
 
  private:
-  std::string format_data_(const std::vector<uint8_t> &data);
+  /// Format data as comma separated hex bytes into buffer, which needs room for 5 characters per byte
+  void format_data_(const AEHAPayload &data, char *buffer);
 };
 
 DECLARE_REMOTE_PROTOCOL(AEHA)
@@ -29,9 +31,9 @@ DECLARE_REMOTE_PROTOCOL(AEHA)
 template<typename... Ts> class AEHAAction : public RemoteTransmitterActionBase<Ts...> {
  public:
   TEMPLATABLE_VALUE(uint16_t, address)
-  TEMPLATABLE_VALUE(std::vector<uint8_t>, data)
+  TEMPLATABLE_VALUE(AEHAPayload, data)
 
-  void set_data(const std::vector<uint8_t> &data) { data_ = data; }
+  void set_data(const AEHAPayload &data) { data_ = data; }
   void encode(RemoteTransmitData *dst, Ts... x) override {
     AEHAData data{};
     data.address = this->address_.value(x...);
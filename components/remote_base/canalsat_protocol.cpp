@@ -1,6 +1,8 @@
 #include "canalsat_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_PROTOCOL_CANALSAT
+
 namespace esphome {
 namespace remote_base {
 
@@ -106,3 +108,5 @@ void CanalSatBaseProtocol::dump(const CanalSatData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif
@@ -1,6 +1,8 @@
 #include "coolix_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_PROTOCOL_COOLIX
+
 namespace esphome {
 namespace remote_base {
 
@@ -90,6 +92,9 @@ static bool decode_frame(RemoteReceiveData &src, uint32_t &dst) {
 }
 
 optional<CoolixData> CoolixProtocol::decode(RemoteReceiveData data) {
+  // data is always followed by its complement, so a frame has both zero and one spaces
+  if (!data.may_have_mark(HEADER_MARK_US) || !data.may_have_space(BIT_ONE_SPACE_US))
+    return {};
   CoolixData result;
   const auto size = data.size();
   if ((size != 200 && size != 100) || !decode_frame(data, result.first))
@@ -111,3 +116,5 @@ void CoolixProtocol::dump(const CoolixData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif
@@ -1,6 +1,8 @@
 #include "dish_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_PROTOCOL_DISH
+
 namespace esphome {
 namespace remote_base {
 
@@ -65,6 +67,7 @@ optional<DishData> DishProtocol::decode(RemoteReceiveData src) {
     }
   }
 
+  // unit codes 17 to 32 take a fifth address bit from the padding, which the encoder always sends as 0
   for (uint8_t mask = 1UL; mask < 1UL << 5; mask <<= 1) {
     if (src.expect_item(BIT_HIGH_US, BIT_ONE_LOW_US)) {
       data.address |= mask;
@@ -74,7 +77,7 @@ optional<DishData> DishProtocol::decode(RemoteReceiveData src) {
       return {};
     }
   }
-  for (uint j = 0; j < 6; j++) {
+  for (uint j = 0; j < 5; j++) {
     if (!src.expect_item(BIT_HIGH_US, BIT_ZERO_LOW_US)) {
       return {};
     }
@@ -92,3 +95,5 @@ void DishProtocol::dump(const DishData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif
@@ -1,6 +1,8 @@
 #include "drayton_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_PROTOCOL_DRAYTON
+
 namespace esphome {
 namespace remote_base {
 
@@ -211,3 +213,5 @@ void DraytonProtocol::dump(const DraytonData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif
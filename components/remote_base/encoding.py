@@ -0,0 +1,148 @@
+# Codegen-time encoders of the pulse distance protocols. A transmit action whose
+# values are all constant is encoded by these while generating code and sends the
+# timings from a table in flash, instead of encoding the frame on every send.
+#
+# Each function mirrors the encode() of its C++ protocol and returns
+# (carrier_frequency, timings), with marks positive and spaces negative, in µs.
+# tests/host/test_static_encoding checks them against the C++ encoders.
+#
+# No esphome imports, so the host tests can load this file on its own.
+
+
+class _Frame:
+    def __init__(self, carrier_frequency):
+        self.carrier_frequency = carrier_frequency
+        self.timings = []
+
+    def item(self, mark, space):
+        self.timings += [mark, -space]
+
+    def mark(self, length):
+        self.timings.append(length)
+
+    def space(self, length):
+        self.timings.append(-length)
+
+    # nbits of value, most significant first, as a mark followed by a one or zero space
+    def bits(self, value, nbits, mark, one, zero):
+        for bit in reversed(range(nbits)):
+            self.item(mark, one if (value >> bit) & 1 else zero)
+
+    # the same, least significant bit first
+    def bits_lsb(self, value, nbits, mark, one, zero):
+        for bit in range(nbits):
+            self.item(mark, one if (value >> bit) & 1 else zero)
+
+    def result(self):
+        return self.carrier_frequency, self.timings
+
+
+def dish(address, command):
+    frame = _Frame(57600)
+    frame.item(400, 6100)
+    for _ in range(4):
+        frame.bits(command, 6, 400, 1700, 2800)
+        frame.bits_lsb(address - 1, 4, 400, 1700, 2800)
+        frame.bits(0, 6, 400, 1700, 2800)
+        frame.item(400, 6100)
+    return frame.result()
+
+
+def jvc(data):
+    frame = _Frame(38000)
+    frame.item(8400, 4200)
+    frame.bits(data, 16, 525, 1725, 525)
+    frame.mark(525)
+    return frame.result()
+
+
+def lg(data, nbits):
+    frame = _Frame(38000)
+    frame.item(8000, 4000)
+    frame.bits(data, nbits, 600, 1600, 550)
+    frame.mark(600)
+    return frame.result()
+
+
+def nec(address, command):
+    frame = _Frame(38000)
+    frame.item(9000, 4500)
+    frame.bits_lsb(address, 16, 560, 1690, 560)
+    frame.bits_lsb(command, 16, 560, 1690, 560)
+    frame.mark(560)
+    return frame.result()
+
+
+def panasonic(address, command):
+    frame = _Frame(35000)
+    frame.item(3502, 1750)
+    frame.bits(address, 16, 502, 1244, 400)
+    frame.bits(command, 32, 502, 1244, 400)
+    frame.mark(502)
+    return frame.result()
+
+
+def _pioneer_words(rc_code):
+    address = (rc_code & 0xFF00) | (~(rc_code >> 8) & 0xFF)
+    # the low byte of rc_code with its nibbles swapped and their bits reversed
+    command = 0
+    for bit in range(4):
+        if (rc_code >> bit) & 1:
+            command |= 1 << (7 - bit)
+        if (rc_code >> (bit + 4)) & 1:
+            command |= 1 << (3 - bit)
+    return address, (command << 8) | (~command & 0xFF)
+
+
+def pioneer(rc_code_1, rc_code_2):
+    frame = _Frame(40000)
+    for index, rc_code in enumerate((rc_code_1, rc_code_2)):
+        if index == 1:
+            if rc_code == 0:
+                break
+            frame.space(25500)
+        address, command = _pioneer_words(rc_code)
+        frame.item(9000, 4500)
+        frame.bits(address, 16, 560, 1690, 560)
+        frame.bits(command, 16, 560, 1690, 560)
+        frame.mark(560)
+    return frame.result()
+
+
+def samsung(data, nbits):
+    frame = _Frame(38000)
+    frame.item(4500, 4500)
+    frame.bits(data, nbits, 560, 1690, 560)
+    frame.item(560, 560)
+    return frame.result()
+
+
+def samsung36(address, command):
+    frame = _Frame(38000)
+    frame.item(4500, 4500)
+    frame.bits(address, 16, 500, 1500, 500)
+    frame.item(500, 4500)
+    frame.bits(command, 20, 500, 1500, 500)
+    frame.item(500, 59000)
+    return frame.result()
+
+
+def sony(data, nbits):
+    frame = _Frame(40000)
+    frame.item(2400, 600)
+    # pulse width: the mark carries the bit
+    for bit in reversed(range(nbits)):
+        frame.item(1200 if (data >> bit) & 1 else 600, 600)
+    return frame.result()
+
+
+def toshiba_ac(rc_code_1, rc_code_2):
+    frame = _Frame(38000)
+    # rc_code_1 goes out twice, rc_code_2 once if there is one
+    for index, rc_code in enumerate((rc_code_1, rc_code_1, rc_code_2)):
+        if index == 2 and rc_code == 0:
+            break
+        frame.item(4500, 4500)
+        frame.bits(rc_code, 48, 560, 1690, 560)
+        frame.item(560, 4500)
+    return frame.result()
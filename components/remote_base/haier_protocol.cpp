@@ -1,6 +1,8 @@
 #include "haier_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_PROTOCOL_HAIER
+
 namespace esphome {
 namespace remote_base {
 
@@ -25,6 +27,10 @@ void HaierProtocol::encode_byte_(RemoteTransmitData *dst, uint8_t item) {
 }
 
 void HaierProtocol::encode(RemoteTransmitData *dst, const HaierData &data) {
+  if (data.data.overflowed()) {
+    ESP_LOGE(TAG, "Data is longer than %u bytes, not sending", HAIER_MAX_DATA_BYTES);
+    return;
+  }
   dst->set_carrier_frequency(38000);
   dst->reserve(5 + ((data.data.size() + 1) * 2));
   dst->mark(HEADER_LOW_US);
@@ -77,8 +83,12 @@ optional<HaierData> HaierProtocol::decode(RemoteReceiveData src) {
 }
 
 void HaierProtocol::dump(const HaierData &data) {
-  ESP_LOGI(TAG, "Received Haier: %s", format_hex_pretty(data.data).c_str());
+  char buffer[HAIER_MAX_DATA_BYTES * 3];
+  format_hex_dotted(buffer, data.data.data(), data.data.size());
+  ESP_LOGI(TAG, "Received Haier: %s (%u)", buffer, (unsigned) data.data.size());
 }
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif
@@ -1,13 +1,16 @@
 #pragma once
 
 #include "remote_base.h"
-#include <vector>
 
 namespace esphome {
 namespace remote_base {
 
+/// A whole packet; decoded data holds the bytes before its checksum
+static const uint8_t HAIER_MAX_DATA_BYTES = 14;
+using HaierPayload = StaticVector<uint8_t, HAIER_MAX_DATA_BYTES>;
+
 struct HaierData {
-  std::vector<uint8_t> data;
+  HaierPayload data;
 
   bool operator==(const HaierData &rhs) const { return data == rhs.data; }
 };
@@ -26,9 +29,9 @@ DECLARE_REMOTE_PROTOCOL(Haier)
 
 template<typename... Ts> class HaierAction : public RemoteTransmitterActionBase<Ts...> {
  public:
-  TEMPLATABLE_VALUE(std::vector<uint8_t>, data)
+  TEMPLATABLE_VALUE(HaierPayload, data)
 
-  void set_code(const std::vector<uint8_t> &code) { data_ = code; }
+  void set_code(const HaierPayload &code) { data_ = code; }
   void encode(RemoteTransmitData *dst, Ts... x) override {
     HaierData data{};
     data.data = this->data_.value(x...);
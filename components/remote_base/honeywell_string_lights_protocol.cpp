@@ -1,6 +1,8 @@
 #include "honeywell_string_lights_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_PROTOCOL_HONEYWELL_STRING_LIGHTS
+
 namespace esphome {
 namespace remote_base {
 
@@ -56,3 +58,5 @@ void HSLProtocol::dump(const HSLData &data) { ESP_LOGD(TAG, "Received HSL: data=
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif
@@ -1,6 +1,8 @@
 #include "jvc_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_PROTOCOL_JVC
+
 namespace esphome {
 namespace remote_base {
 
@@ -50,3 +52,5 @@ void JVCProtocol::dump(const JVCData &data) { ESP_LOGI(TAG, "Received JVC: data=
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif
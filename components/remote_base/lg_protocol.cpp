@@ -1,6 +1,8 @@
 #include "lg_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_PROTOCOL_LG
+
 namespace esphome {
 namespace remote_base {
 
@@ -56,3 +58,5 @@ void LGProtocol::dump(const LGData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif
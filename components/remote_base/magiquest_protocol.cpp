@@ -5,6 +5,8 @@
  * https://arduino-irremote.github.io/Arduino-IRremote/ir__MagiQuest_8cpp_source.html
  */
 
+#ifdef USE_REMOTE_PROTOCOL_MAGIQUEST
+
 namespace esphome {
 namespace remote_base {
 
@@ -81,3 +83,5 @@ void MagiQuestProtocol::dump(const MagiQuestData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif
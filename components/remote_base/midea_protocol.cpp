@@ -1,6 +1,8 @@
 #include "midea_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_PROTOCOL_MIDEA
+
 namespace esphome {
 namespace remote_base {
 
@@ -62,6 +64,9 @@ static bool decode_data(RemoteReceiveData &src, MideaData &dst) {
 }
 
 optional<MideaData> MideaProtocol::decode(RemoteReceiveData src) {
+  // data is always followed by its complement, so a frame has both zero and one spaces
+  if (!src.may_have_mark(HEADER_MARK_US) || !src.may_have_space(BIT_ONE_SPACE_US))
+    return {};
   MideaData out, inv;
   if (src.expect_item(HEADER_MARK_US, HEADER_SPACE_US) && decode_data(src, out) && out.is_valid() &&
       src.expect_item(FOOTER_MARK_US, FOOTER_SPACE_US) && src.expect_item(HEADER_MARK_US, HEADER_SPACE_US) &&
@@ -70,7 +75,13 @@ optional<MideaData> MideaProtocol::decode(RemoteReceiveData src) {
   return {};
 }
 
-void MideaProtocol::dump(const MideaData &data) { ESP_LOGI(TAG, "Received Midea: %s", data.to_string().c_str()); }
+void MideaProtocol::dump(const MideaData &data) {
+  char buffer[6 * 3];  // 3 characters for each of the 6 bytes
+  format_hex_dotted(buffer, data.data(), data.size());
+  ESP_LOGI(TAG, "Received Midea: %s (%u)", buffer, data.size());
+}
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif
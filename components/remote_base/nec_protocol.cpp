@@ -1,6 +1,8 @@
 #include "nec_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_PROTOCOL_NEC
+
 namespace esphome {
 namespace remote_base {
 
@@ -72,3 +74,5 @@ void NECProtocol::dump(const NECData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif
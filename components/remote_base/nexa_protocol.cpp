@@ -1,6 +1,8 @@
 #include "nexa_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_PROTOCOL_NEXA
+
 namespace esphome {
 namespace remote_base {
 
@@ -238,3 +240,5 @@ void NexaProtocol::dump(const NexaData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif
@@ -1,6 +1,8 @@
 #include "panasonic_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_PROTOCOL_PANASONIC
+
 namespace esphome {
 namespace remote_base {
 
@@ -72,3 +74,5 @@ void PanasonicProtocol::dump(const PanasonicData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif
@@ -1,6 +1,8 @@
 #include "pioneer_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_PROTOCOL_PIONEER
+
 namespace esphome {
 namespace remote_base {
 
@@ -154,3 +156,5 @@ void PioneerProtocol::dump(const PioneerData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif
@@ -35,6 +35,8 @@
 #include "pronto_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_PROTOCOL_PRONTO
+
 namespace esphome {
 namespace remote_base {
 
@@ -68,6 +70,7 @@ static const uint16_t NUMBERS_IN_PREAMBLE = 4U;
 static const uint16_t HEX_MASK = 0xFU;
 static const uint32_t REFERENCE_FREQUENCY = 4145146UL;
 static const uint16_t FALLBACK_FREQUENCY = 64767U;  // To use with frequency = 0;
+static const uint16_t DEFAULT_FREQUENCY = 38000U;   // When the receiver doesn't know the carrier
 static const uint32_t MICROSECONDS_IN_SECONDS = 1000000UL;
 static const uint16_t PRONTO_DEFAULT_GAP = 45000;
 static const uint16_t MARK_EXCESS_MICROS = 20;
@@ -105,7 +108,7 @@ void ProntoProtocol::send_pronto_(RemoteTransmitData *dst, const std::vector<uin
   uint16_t repeats = 2 * data[3];
   ESP_LOGD(TAG, "Send Pronto: intros=%d", intros);
   ESP_LOGD(TAG, "Send Pronto: repeats=%d", repeats);
-  if (NUMBERS_IN_PREAMBLE + intros + repeats != data.size()) {  // inconsistent sizes
+  if (size_t(NUMBERS_IN_PREAMBLE + intros + repeats) != data.size()) {  // inconsistent sizes
     ESP_LOGE(TAG, "Inconsistent data, not sending");
     return;
   }
@@ -165,80 +168,80 @@ uint16_t ProntoProtocol::to_frequency_code_(uint16_t frequency) {
   return REFERENCE_FREQUENCY / effective_frequency_(frequency);
 }
 
-std::string ProntoProtocol::dump_digit_(uint8_t x) {
-  return std::string(1, (char) (x <= 9 ? ('0' + x) : ('A' + (x - 10))));
-}
-
-std::string ProntoProtocol::dump_number_(uint16_t number, bool end /* = false */) {
-  std::string num;
+char ProntoProtocol::dump_digit_(uint8_t x) { return (char) (x <= 9 ? ('0' + x) : ('A' + (x - 10))); }
 
+void ProntoProtocol::dump_number_(std::string &out, uint16_t number, bool end /* = false */) {
   for (uint8_t i = 0; i < DIGITS_IN_PRONTO_NUMBER; ++i) {
     uint8_t shifts = BITS_IN_HEXADECIMAL * (DIGITS_IN_PRONTO_NUMBER - 1 - i);
-    num += dump_digit_((number >> shifts) & HEX_MASK);
+    out += dump_digit_((number >> shifts) & HEX_MASK);
   }
 
   if (!end)
-    num += ' ';
-
-  return num;
+    out += ' ';
 }
 
-std::string ProntoProtocol::dump_duration_(uint32_t duration, uint16_t timebase, bool end /* = false */) {
-  return dump_number_((duration + timebase / 2) / timebase, end);
+void ProntoProtocol::dump_duration_(std::string &out, uint32_t duration, uint16_t timebase, bool end /* = false */) {
+  // a zero would end the sequence when parsed
+  dump_number_(out, std::max<uint32_t>((duration + timebase / 2) / timebase, 1), end);
 }
 
-std::string ProntoProtocol::compensate_and_dump_sequence_(const RawTimings &data, uint16_t timebase) {
-  std::string out;
-
-  for (int32_t t_length : data) {
+void ProntoProtocol::compensate_and_dump_sequence_(std::string &out, RawTimings::const_iterator begin,
+                                                   RawTimings::const_iterator end, uint16_t timebase) {
+  for (auto it = begin; it != end; ++it) {
+    const int32_t t_length = *it;
     uint32_t t_duration;
     if (t_length > 0) {
       // Mark
-      t_duration = t_length - MARK_EXCESS_MICROS;
+      t_duration = t_length > MARK_EXCESS_MICROS ? t_length - MARK_EXCESS_MICROS : 0;
     } else {
       t_duration = -t_length + MARK_EXCESS_MICROS;
     }
-    out += dump_duration_(t_duration, timebase);
+    dump_duration_(out, t_duration, timebase, it + 1 == end && t_length < 0);
   }
 
-  // append minimum gap
-  out += dump_duration_(PRONTO_DEFAULT_GAP, timebase, true);
-
-  return out;
+  // a frame captured with its trailing gap already has whole mark and space pairs; others get the minimum gap
+  if (begin == end || *(end - 1) > 0)
+    dump_duration_(out, PRONTO_DEFAULT_GAP, timebase, true);
 }
 
 optional<ProntoData> ProntoProtocol::decode(RemoteReceiveData src) {
   ProntoData out;
+  this->decode_into(src, &out);
+  return out;
+}
 
-  uint16_t frequency = 38000U;
-  auto &data = src.get_raw_data();
-  std::string prontodata;
-
-  prontodata += dump_number_(frequency > 0 ? LEARNED_TOKEN : LEARNED_NON_MODULATED_TOKEN);
-  prontodata += dump_number_(to_frequency_code_(frequency));
-  prontodata += dump_number_((data.size() + 1) / 2);
-  prontodata += dump_number_(0);
+bool ProntoProtocol::decode_into(RemoteReceiveData src, ProntoData *out) {
+  uint16_t frequency = DEFAULT_FREQUENCY;
+  if (src.get_carrier_frequency() != 0)
+    frequency = std::min(src.get_carrier_frequency(), uint32_t(UINT16_MAX));
+  std::string &prontodata = out->data;
+  prontodata.clear();
+  // every number takes its digits and a separator, so the string is allocated at most once, at its final size
+  prontodata.reserve((NUMBERS_IN_PREAMBLE + src.size() + 1) * (DIGITS_IN_PRONTO_NUMBER + 1));
+
+  dump_number_(prontodata, frequency > 0 ? LEARNED_TOKEN : LEARNED_NON_MODULATED_TOKEN);
+  dump_number_(prontodata, to_frequency_code_(frequency));
+  dump_number_(prontodata, (src.size() + 1) / 2);
+  dump_number_(prontodata, 0);
   uint16_t timebase = to_timebase_(frequency);
-  prontodata += compensate_and_dump_sequence_(data, timebase);
-
-  out.data = prontodata;
+  compensate_and_dump_sequence_(prontodata, src.begin(), src.end(), timebase);
 
-  return out;
+  return true;
 }
 
 void ProntoProtocol::dump(const ProntoData &data) {
-  std::string first, rest;
+  // log the two halves straight from data, without copying them out
+  const char *str = data.data.c_str();
   if (data.data.size() < 230) {
-    first = data.data;
+    ESP_LOGI(TAG, "Received Pronto: data=%s", str);
   } else {
-    first = data.data.substr(0, 229);
-    rest = data.data.substr(230);
-  }
-  ESP_LOGI(TAG, "Received Pronto: data=%s", first.c_str());
-  if (!rest.empty()) {
-    ESP_LOGI(TAG, "%s", rest.c_str());
+    ESP_LOGI(TAG, "Received Pronto: data=%.*s", 229, str);
+    if (data.data.size() > 230)
+      ESP_LOGI(TAG, "%s", str + 230);
   }
 }
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif
@@ -24,14 +24,18 @@ class ProntoProtocol : public RemoteProtocol<ProntoData> {
   uint16_t effective_frequency_(uint16_t frequency);
   uint16_t to_timebase_(uint16_t frequency);
   uint16_t to_frequency_code_(uint16_t frequency);
-  std::string dump_digit_(uint8_t x);
-  std::string dump_number_(uint16_t number, bool end = false);
-  std::string dump_duration_(uint32_t duration, uint16_t timebase, bool end = false);
-  std::string compensate_and_dump_sequence_(const RawTimings &data, uint16_t timebase);
+  char dump_digit_(uint8_t x);
+  /// The dump functions append to out
+  void dump_number_(std::string &out, uint16_t number, bool end = false);
+  void dump_duration_(std::string &out, uint32_t duration, uint16_t timebase, bool end = false);
+  void compensate_and_dump_sequence_(std::string &out, RawTimings::const_iterator begin, RawTimings::const_iterator end,
+                                     uint16_t timebase);
 
  public:
   void encode(RemoteTransmitData *dst, const ProntoData &data) override;
   optional<ProntoData> decode(RemoteReceiveData src) override;
+  /// Reuses the string of out, so decoding into the same data again only allocates for longer frames
+  bool decode_into(RemoteReceiveData src, ProntoData *out) override;
   void dump(const ProntoData &data) override;
 };
 
@@ -1,6 +1,8 @@
 #include "raw_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_PROTOCOL_RAW
+
 namespace esphome {
 namespace remote_base {
 
@@ -40,8 +42,13 @@ bool RawDumper::dump(RemoteReceiveData src) {
   if (buffer_offset != 0) {
     ESP_LOGI(TAG, "%s", buffer);
   }
+  if (src.get_carrier_frequency() != 0) {
+    ESP_LOGI(TAG, "  Carrier frequency: %" PRIu32 " Hz", src.get_carrier_frequency());
+  }
   return true;
 }
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif
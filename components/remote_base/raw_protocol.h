@@ -32,12 +32,19 @@ class RawBinarySensor : public RemoteReceiverBinarySensorBase {
   size_t len_;
 };
 
-class RawTrigger : public Trigger<RawTimings>, public Component, public RemoteReceiverListener {
+class RawTrigger : public Trigger<const RawTimings &>, public Component, public RemoteReceiverListener {
+ public:
+  bool wants_every_frame() const override { return true; }
+
  protected:
   bool on_receive(RemoteReceiveData src) override {
-    this->trigger(src.get_raw_data());
+    // the segment is copied into a buffer kept across frames, which stops growing once it fits the longest one
+    this->timings_.assign(src.begin(), src.end());
+    this->trigger(this->timings_);
     return false;
   }
+
+  RawTimings timings_;
 };
 
 template<typename... Ts> class RawAction : public RemoteTransmitterActionBase<Ts...> {
@@ -1,6 +1,8 @@
 #include "rc5_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_PROTOCOL_RC5
+
 namespace esphome {
 namespace remote_base {
 
@@ -37,49 +39,52 @@ void RC5Protocol::encode(RemoteTransmitData *dst, const RC5Data &data) {
   toggle = !toggle;
 }
 optional<RC5Data> RC5Protocol::decode(RemoteReceiveData src) {
-  RC5Data out{
-      .address = 0,
-      .command = 0,
-  };
-  uint8_t field_bit;
-
-  if (src.expect_space(BIT_TIME_US) && src.expect_mark(BIT_TIME_US)) {
-    field_bit = 1;
-  } else if (src.expect_space(2 * BIT_TIME_US)) {
-    field_bit = 0;
-  } else {
-    return {};
+  // Manchester coded: a one is a space then a mark, a zero a mark then a space, each half a bit time long. Equal halves
+  // of adjacent bits join into one timing, so first split the frame into its half bits, marks set.
+  uint32_t halves = 0;
+  uint8_t count = 0;
+  // the leading space of the start bit is usually lost in the idle time before the frame
+  if (src.is_valid(0) && src.peek() > 0)
+    count++;
+  while (count < NBITS * 2 && src.is_valid(0)) {
+    if (src.expect_mark(BIT_TIME_US)) {
+      halves |= 1UL << count;
+      count += 1;
+    } else if (src.expect_mark(2 * BIT_TIME_US)) {
+      halves |= 3UL << count;
+      count += 2;
+    } else if (src.expect_space(BIT_TIME_US)) {
+      count += 1;
+    } else if (src.expect_space(2 * BIT_TIME_US)) {
+      count += 2;
+    } else {
+      break;
+    }
   }
-
-  if (!(((src.expect_space(BIT_TIME_US) || src.peek_space(2 * BIT_TIME_US)) ||
-         (src.expect_mark(BIT_TIME_US) || src.peek_mark(2 * BIT_TIME_US))) &&
-        (((src.expect_mark(BIT_TIME_US) || src.expect_mark(2 * BIT_TIME_US)) &&
-          (src.expect_space(BIT_TIME_US) || src.peek_space(2 * BIT_TIME_US))) ||
-         ((src.expect_space(BIT_TIME_US) || src.expect_space(2 * BIT_TIME_US)) &&
-          (src.expect_mark(BIT_TIME_US) || src.peek_mark(2 * BIT_TIME_US)))))) {
+  // the trailing space of a zero runs into the gap after the frame
+  if (count == NBITS * 2 - 1 && (halves >> (count - 1)) & 1)
+    count++;
+  if (count != NBITS * 2)
     return {};
-  }
 
   uint32_t out_data = 0;
-  for (int bit = NBITS - 4; bit >= 1; bit--) {
-    if ((src.expect_space(BIT_TIME_US) || src.expect_space(2 * BIT_TIME_US)) &&
-        (src.expect_mark(BIT_TIME_US) || src.peek_mark(2 * BIT_TIME_US))) {
-      out_data |= 0 << bit;
-    } else if ((src.expect_mark(BIT_TIME_US) || src.expect_mark(2 * BIT_TIME_US)) &&
-               (src.expect_space(BIT_TIME_US) || src.peek_space(2 * BIT_TIME_US))) {
-      out_data |= 1 << bit;
+  for (uint8_t bit = 0; bit < NBITS; bit++) {
+    const uint8_t pair = (halves >> (bit * 2)) & 3;
+    if (pair == 0b10) {
+      out_data = (out_data << 1) | 1;
+    } else if (pair == 0b01) {
+      out_data <<= 1;
     } else {
       return {};
     }
   }
-  if (src.expect_space(BIT_TIME_US) || src.expect_space(2 * BIT_TIME_US)) {
-    out_data |= 0;
-  } else if (src.expect_mark(BIT_TIME_US) || src.expect_mark(2 * BIT_TIME_US)) {
-    out_data |= 1;
-  }
-
-  out.command = (uint8_t) (out_data & 0x3F) + (1 - field_bit) * 64u;
-  out.address = (out_data >> 6) & 0x1F;
+  // the start bits are 0b11, or 0b10 for commands from 64 on
+  if (!(out_data & (1 << (NBITS - 1))))
+    return {};
+  RC5Data out{
+      .address = uint8_t((out_data >> 6) & 0x1F),
+      .command = uint8_t((out_data & 0x3F) + ((out_data & (1 << (NBITS - 2))) ? 0 : 64)),
+  };
   return out;
 }
 void RC5Protocol::dump(const RC5Data &data) {
@@ -88,3 +93,5 @@ void RC5Protocol::dump(const RC5Data &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif
@@ -1,6 +1,8 @@
 #include "rc6_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_PROTOCOL_RC6
+
 namespace esphome {
 namespace remote_base {
 
@@ -179,3 +181,5 @@ void RC6Protocol::dump(const RC6Data &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif
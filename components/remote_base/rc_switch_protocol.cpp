@@ -1,6 +1,8 @@
 #include "rc_switch_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_PROTOCOL_RC_SWITCH
+
 namespace esphome {
 namespace remote_base {
 
@@ -269,3 +271,5 @@ bool RCSwitchDumper::dump(RemoteReceiveData src) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif
@@ -1,29 +1,112 @@
 #include "remote_base.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+#include <cinttypes>
+
 namespace esphome {
 namespace remote_base {
 
 static const char *const TAG = "remote_base";
 
+#ifdef USE_REMOTE_CAPTURE
+RemoteCaptureSink *global_remote_capture_sink = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#endif
+
 #ifdef USE_ESP32
-RemoteRMTChannel::RemoteRMTChannel(uint8_t mem_block_num) : mem_block_num_(mem_block_num) {
-  static rmt_channel_t next_rmt_channel = RMT_CHANNEL_0;
-  this->channel_ = next_rmt_channel;
-  next_rmt_channel = rmt_channel_t(int(next_rmt_channel) + mem_block_num);
+static std::vector<RemoteRMTChannel *> &rmt_channels() {
+  static std::vector<RemoteRMTChannel *> channels;
+  return channels;
 }
 
-void RemoteRMTChannel::config_rmt(rmt_config_t &rmt) {
-  if (rmt_channel_t(int(this->channel_) + this->mem_block_num_) >= RMT_CHANNEL_MAX) {
-    this->mem_block_num_ = int(RMT_CHANNEL_MAX) - int(this->channel_);
-    ESP_LOGW(TAG, "Not enough RMT memory blocks available, reduced to %i blocks.", this->mem_block_num_);
+RemoteRMTChannel::RemoteRMTChannel(uint8_t mem_block_num) : mem_block_num_(std::max<uint8_t>(mem_block_num, 1)) {
+  rmt_channels().push_back(this);
+}
+
+void RemoteRMTChannel::allocate_() {
+  static bool allocated = false;
+  if (allocated)
+    return;
+  allocated = true;
+
+  auto &channels = rmt_channels();
+  const auto by_blocks = [](RemoteRMTChannel *a, RemoteRMTChannel *b) { return a->mem_block_num_ < b->mem_block_num_; };
+  uint32_t used = 0;
+  for (auto *channel : channels)
+    used += channel->mem_block_num_;
+
+  // requested blocks come first; if they don't all fit, the largest requests give way
+  while (used > RMT_CHANNEL_MAX) {
+    auto *largest = *std::max_element(channels.begin(), channels.end(), by_blocks);
+    if (largest->mem_block_num_ == 1)
+      break;  // more users than channels
+    largest->mem_block_num_--;
+    used--;
   }
+  // blocks left over go one at a time to the channel whose largest frame is furthest from fitting
+  while (used < RMT_CHANNEL_MAX) {
+    RemoteRMTChannel *neediest = nullptr;
+    uint32_t largest_deficit = 0;
+    for (auto *channel : channels) {
+      const uint32_t capacity = channel->mem_block_num_ * SOC_RMT_MEM_WORDS_PER_CHANNEL;
+      if (channel->max_frame_items_ > capacity && channel->max_frame_items_ - capacity > largest_deficit) {
+        neediest = channel;
+        largest_deficit = channel->max_frame_items_ - capacity;
+      }
+    }
+    if (neediest == nullptr)
+      break;
+    neediest->mem_block_num_++;
+    used++;
+  }
+
+  int next_channel = RMT_CHANNEL_0;
+  for (auto *channel : channels) {
+    channel->channel_ = rmt_channel_t(std::min(next_channel, int(RMT_CHANNEL_MAX)));
+    next_channel += channel->mem_block_num_;
+  }
+}
+
+void RemoteRMTChannel::dump_rmt_allocation() {
+  RemoteRMTChannel::allocate_();
+  ESP_LOGCONFIG(TAG, "RMT allocation:");
+  for (auto *channel : rmt_channels()) {
+    if (channel->channel_ >= RMT_CHANNEL_MAX) {
+      ESP_LOGE(TAG, "  No RMT channel left for a user requesting %u blocks", channel->mem_block_num_);
+      continue;
+    }
+    ESP_LOGCONFIG(TAG, "  Channel %d: %u blocks (%u items), largest frame %" PRIu32 " items", channel->channel_,
+                  channel->mem_block_num_, channel->mem_block_num_ * SOC_RMT_MEM_WORDS_PER_CHANNEL,
+                  channel->max_frame_items_);
+  }
+}
+
+void RemoteRMTChannel::config_rmt(rmt_config_t &rmt) {
+  RemoteRMTChannel::allocate_();
+  if (this->channel_ >= RMT_CHANNEL_MAX)
+    ESP_LOGE(TAG, "Not enough RMT channels available");
   rmt.channel = this->channel_;
   rmt.clk_div = this->clock_divider_;
   rmt.mem_block_num = this->mem_block_num_;
 }
 #endif
 
+/* RemoteTransmitData */
+
+void RemoteTransmitData::set_data(const RawTimings &data) {
+  this->data_ = data;
+  this->duration_ = 0;
+  this->edges_ = 0;
+  this->rmt_durations_ = 0;
+  for (int32_t item : this->data_) {
+    if (item >= 0) {
+      this->account_(item, true);
+    } else {
+      this->account_(-item, false);
+    }
+  }
+}
+
 /* RemoteReceiveData */
 
 bool RemoteReceiveData::peek_mark(uint32_t length, uint32_t offset) const {
@@ -80,44 +163,481 @@ bool RemoteReceiveData::expect_pulse_with_gap(uint32_t mark, uint32_t space) {
   return true;
 }
 
+/* Carrier detection */
+
+// carrier periods longer than this (below ~20kHz) are treated as regular marks/spaces
+static const uint32_t MAX_CARRIER_PERIOD_US = 50;
+static const uint32_t MIN_CARRIER_PULSES = 8;
+
+uint32_t estimate_carrier_frequency(const RawTimings &data) {
+  uint32_t period_sum = 0;
+  uint32_t periods = 0;
+  for (size_t i = 0; i + 1 < data.size(); i++) {
+    const int32_t mark = data[i];
+    const int32_t space = -data[i + 1];
+    if (mark <= 0 || space <= 0)
+      continue;
+    const uint32_t period = mark + space;
+    if (period > MAX_CARRIER_PERIOD_US)
+      continue;
+    period_sum += period;
+    periods++;
+  }
+  if (periods < MIN_CARRIER_PULSES)
+    return 0;
+  return (1000000UL * periods + period_sum / 2) / period_sum;
+}
+
+void collapse_carrier(RawTimings &data, uint32_t carrier_frequency) {
+  if (carrier_frequency == 0 || data.empty())
+    return;
+  // a space of up to two carrier periods belongs to the burst around it
+  const int32_t max_gap = 2000000UL / carrier_frequency;
+  size_t out = 0;
+  for (size_t i = 0; i < data.size(); i++) {
+    const int32_t value = data[i];
+    if (value < 0 && -value <= max_gap && out > 0 && i + 1 < data.size() && data[out - 1] > 0 && data[i + 1] > 0) {
+      // join this space and the following pulse with the mark being built
+      data[out - 1] += -value + data[i + 1];
+      i++;
+      continue;
+    }
+    if (out > 0 && (data[out - 1] < 0) == (value < 0)) {
+      data[out - 1] += value;
+    } else {
+      data[out++] = value;
+    }
+  }
+  data.resize(out);
+}
+
+void merge_glitches(RawTimings &data, uint32_t threshold) {
+  size_t out = 0;
+  for (size_t i = 0; i < data.size(); i++) {
+    const int32_t value = data[i];
+    if (out > 0 && uint32_t(std::abs(value)) < threshold) {
+      // lengthen the pulse before the glitch by it; the pulse after it then joins that one too
+      data[out - 1] += data[out - 1] < 0 ? -std::abs(value) : std::abs(value);
+    } else if (out > 0 && (data[out - 1] < 0) == (value < 0)) {
+      data[out - 1] += value;
+    } else {
+      data[out++] = value;
+    }
+  }
+  data.resize(out);
+}
+
+RemoteFrameSummary summarize_frame(RawTimings::const_iterator begin, RawTimings::const_iterator end) {
+  RemoteFrameSummary summary;
+  for (auto it = begin; it != end; ++it) {
+    const int32_t value = *it;
+    if (value >= 0) {
+      summary.min_mark = std::min<uint32_t>(summary.min_mark, value);
+      summary.max_mark = std::max<uint32_t>(summary.max_mark, value);
+      summary.duration += value;
+    } else {
+      summary.min_space = std::min<uint32_t>(summary.min_space, -value);
+      summary.max_space = std::max<uint32_t>(summary.max_space, -value);
+      summary.duration += -value;
+    }
+  }
+  return summary;
+}
+
+uint32_t fingerprint_timings(RawTimings::const_iterator begin, RawTimings::const_iterator end) {
+  uint32_t hash = 0x811C9DC5;  // FNV-1a
+  for (auto it = begin; it != end; ++it) {
+    const uint32_t length = std::abs(*it);
+    // position of the highest bit and the two bits below it: four steps per octave
+    uint32_t quantized = 0;
+    if (length >= 4) {
+      const uint32_t msb = 31 - __builtin_clz(length);
+      quantized = (msb << 2) | ((length >> (msb - 2)) & 3);
+    }
+    quantized = (quantized << 1) | (*it < 0);
+    hash = (hash ^ quantized) * 0x01000193;
+  }
+  return hash == 0 ? 1 : hash;
+}
+
+void format_hex_dotted(char *buffer, const uint8_t *data, size_t length) {
+  static const char *const HEX_DIGITS = "0123456789ABCDEF";
+  for (size_t i = 0; i < length; i++) {
+    *buffer++ = HEX_DIGITS[data[i] >> 4];
+    *buffer++ = HEX_DIGITS[data[i] & 0x0F];
+    *buffer++ = '.';
+  }
+  // the last separator becomes the terminator
+  buffer[length == 0 ? 0 : -1] = '\0';
+}
+
 /* RemoteReceiverBinarySensorBase */
 
 bool RemoteReceiverBinarySensorBase::on_receive(RemoteReceiveData src) {
   if (!this->matches(src))
     return false;
+  this->publish_match_();
+  return true;
+}
+
+void RemoteReceiverBinarySensorBase::publish_match_() {
   this->publish_state(true);
   yield();
   this->publish_state(false);
-  return true;
 }
 
 /* RemoteReceiverBase */
 
+void RemoteReceiverBase::register_listener(RemoteReceiverListener *listener) {
+  this->listeners_.push_back(listener);
+  for (auto *dumper : this->dumpers_)
+    dumper->share_decodes(listener);
+  for (auto *dumper : this->secondary_dumpers_)
+    dumper->share_decodes(listener);
+}
+
 void RemoteReceiverBase::register_dumper(RemoteReceiverDumperBase *dumper) {
   if (dumper->is_secondary()) {
     this->secondary_dumpers_.push_back(dumper);
   } else {
     this->dumpers_.push_back(dumper);
   }
+  for (auto *listener : this->listeners_) {
+    if (dumper->share_decodes(listener))
+      break;
+  }
+}
+
+void RemoteReceiverBase::call_listeners_dumpers_() {
+  this->frame_carrier_frequency_ = this->carrier_frequency_;
+  if (this->detect_carrier_) {
+    const uint32_t carrier_frequency = estimate_carrier_frequency(this->temp_);
+    if (carrier_frequency != 0) {
+      collapse_carrier(this->temp_, carrier_frequency);
+      this->frame_carrier_frequency_ = carrier_frequency;
+    }
+  }
+#ifdef USE_REMOTE_CAPTURE
+  if (global_remote_capture_sink != nullptr)
+    global_remote_capture_sink->record_frame(false, this->frame_carrier_frequency_, this->temp_);
+#endif
+  if (this->glitch_threshold_ != 0)
+    merge_glitches(this->temp_, this->glitch_threshold_);
+  if (this->is_noise_()) {
+    this->noise_frames_++;
+    ESP_LOGVV(TAG, "Dropped a frame of %u timings as noise", (unsigned) this->temp_.size());
+    return;
+  }
+  const uint32_t size = this->temp_.size();
+  if (this->segment_gap_ == 0) {
+    this->dispatch_segment_(0, size, 0);
+    return;
+  }
+  uint32_t begin = 0;
+  uint32_t end = this->segment_end_(0);
+  while (begin < size) {
+    // fold the identical segments that follow into this one; the first one that differs is dispatched next
+    uint32_t repeats = 0;
+    uint32_t next = end;
+    uint32_t next_end = end;
+    while (next < size) {
+      next_end = this->segment_end_(next);
+      if (!this->same_segment_(begin, end, next, next_end))
+        break;
+      repeats++;
+      next = next_end;
+    }
+    this->dispatch_segment_(begin, end, repeats);
+    begin = next;
+    end = next_end;
+  }
+}
+
+uint32_t RemoteReceiverBase::segment_end_(uint32_t begin) const {
+  const int32_t gap = this->segment_gap_;
+  for (uint32_t i = begin; i < this->temp_.size(); i++) {
+    if (this->temp_[i] <= -gap)
+      return i + 1;
+  }
+  return this->temp_.size();
+}
+
+bool RemoteReceiverBase::same_segment_(uint32_t a_begin, uint32_t a_end, uint32_t b_begin, uint32_t b_end) const {
+  // the gap closing a segment is left out, as the last segment of a buffer may not have one
+  const int32_t gap = this->segment_gap_;
+  if (this->temp_[a_end - 1] <= -gap)
+    a_end--;
+  if (this->temp_[b_end - 1] <= -gap)
+    b_end--;
+  if (a_end - a_begin != b_end - b_begin)
+    return false;
+  for (uint32_t i = 0; i < a_end - a_begin; i++) {
+    const int32_t a = this->temp_[a_begin + i];
+    const int32_t b = this->temp_[b_begin + i];
+    if ((a < 0) != (b < 0))
+      return false;
+    const uint32_t a_length = std::abs(a);
+    const uint32_t b_length = std::abs(b);
+    if (b_length < a_length * (100 - this->tolerance_) / 100 || b_length > a_length * (100 + this->tolerance_) / 100)
+      return false;
+  }
+  return true;
+}
+
+void RemoteReceiverBase::dispatch_segment_(uint32_t begin, uint32_t end, uint32_t repeats) {
+  this->segment_begin_ = begin;
+  this->segment_size_ = end - begin;
+  this->segment_repeats_ = repeats;
+  if (++this->frame_id_ == 0)
+    this->frame_id_ = 1;
+  this->frame_summary_ = summarize_frame(this->temp_.begin() + begin, this->temp_.begin() + end);
+  this->segment_fingerprint_ = 0;
+  if (this->fingerprint_timeout_ != 0) {
+    this->segment_fingerprint_ = fingerprint_timings(this->temp_.begin() + begin, this->temp_.begin() + end);
+    const uint32_t now = millis();
+    this->fingerprint_lookups_++;
+    FingerprintEntry *entry = this->find_fingerprint_(this->segment_fingerprint_, now);
+    if (entry != nullptr) {
+      this->fingerprint_hits_++;
+      entry->last_seen = now;
+      this->replay_(*entry);
+      return;
+    }
+    // record into the least recently seen entry
+    entry = &this->fingerprint_cache_[0];
+    for (auto &candidate : this->fingerprint_cache_) {
+      if (now - candidate.last_seen > now - entry->last_seen)
+        entry = &candidate;
+    }
+    entry->fingerprint = this->segment_fingerprint_;
+    entry->last_seen = now;
+    entry->listeners.clear();
+    entry->dumpers.clear();
+    this->recording_ = entry;
+  }
+  this->call_listeners_();
+  this->dump_segment_();
+  this->recording_ = nullptr;
+}
+
+void RemoteReceiverBase::dump_segment_() {
+#ifdef USE_REMOTE_DEFERRED_DUMPS
+  if (global_remote_dump_queue != nullptr) {
+    if (!this->dumpers_.empty() || !this->secondary_dumpers_.empty())
+      global_remote_dump_queue->push(this, this->segment_data_());
+    return;
+  }
+#endif
+  this->call_dumpers_(this->segment_data_());
+}
+
+RemoteReceiveData RemoteReceiverBase::segment_data_() const {
+  RemoteReceiveData data(this->temp_, this->tolerance_, this->frame_carrier_frequency_);
+  data.set_segment(this->segment_begin_, this->segment_size_, this->segment_repeats_);
+  data.set_fingerprint(this->segment_fingerprint_);
+  data.set_frame_id(this->frame_id_);
+  data.set_summary(&this->frame_summary_);
+  return data;
+}
+
+RemoteReceiverBase::FingerprintEntry *RemoteReceiverBase::find_fingerprint_(uint32_t fingerprint, uint32_t now) {
+  for (auto &entry : this->fingerprint_cache_) {
+    if (entry.fingerprint == fingerprint && now - entry.last_seen < this->fingerprint_timeout_ &&
+        !entry.listeners.overflowed() && !entry.dumpers.overflowed())
+      return &entry;
+  }
+  return nullptr;
+}
+
+void RemoteReceiverBase::replay_(const FingerprintEntry &entry) {
+  // listeners that didn't claim the frame the first time won't now either, so only the others are called
+  for (auto *listener : entry.listeners) {
+    if (!listener->get_suppress_repeats())
+      this->call_listener_(listener, true);
+  }
+#ifdef USE_REMOTE_DEFERRED_DUMPS
+  // deferred dumps run off the receive path anyway, so they simply get the whole frame again
+  if (global_remote_dump_queue != nullptr) {
+    this->dump_segment_();
+    return;
+  }
+#endif
+  const RemoteReceiveData data = this->segment_data_();
+  for (auto *dumper : entry.dumpers)
+    this->call_dumper_(dumper, data);
+  if (entry.dumpers.empty()) {
+    for (auto *dumper : this->secondary_dumpers_)
+      this->call_dumper_(dumper, data);
+  }
+  if (data.get_repeats() != 0 && !this->dumpers_.empty())
+    ESP_LOGI(TAG, "  repeated %" PRIu32 " more times", data.get_repeats());
+}
+
+bool RemoteReceiverBase::is_noise_() const {
+  if (this->temp_.size() < this->min_frame_timings_)
+    return true;
+  if (this->max_distinct_timings_ == 0)
+    return false;
+  uint32_t lengths[MAX_DISTINCT_TIMINGS];
+  uint8_t count = 0;
+  for (int32_t value : this->temp_) {
+    const uint32_t length = std::abs(value);
+    bool known = false;
+    for (uint8_t i = 0; i < count && !known; i++) {
+      known = lengths[i] * (100 - this->tolerance_) / 100 <= length &&
+              length <= lengths[i] * (100 + this->tolerance_) / 100;
+    }
+    if (known)
+      continue;
+    if (count == this->max_distinct_timings_)
+      return true;
+    lengths[count++] = length;
+  }
+  return false;
+}
+
+bool RemoteReceiverBase::call_listener_(RemoteReceiverListener *listener, bool repeat) {
+  const RemoteReceiveData data = this->segment_data_();
+#ifdef USE_REMOTE_RECEIVER_PROFILING
+  const uint32_t start = arch_get_cpu_cycle_count();
+  const bool claimed = repeat ? listener->on_repeat(data) : listener->on_receive(data);
+  listener->get_profile_stats().record(arch_get_cpu_cycle_count() - start, claimed);
+#else
+  const bool claimed = repeat ? listener->on_repeat(data) : listener->on_receive(data);
+#endif
+  if (this->recording_ != nullptr && (claimed || listener->wants_every_frame()))
+    this->recording_->listeners.push_back(listener);
+  return claimed;
+}
+
+bool RemoteReceiverBase::call_dumper_(RemoteReceiverDumperBase *dumper, const RemoteReceiveData &data) {
+#ifdef USE_REMOTE_RECEIVER_PROFILING
+  const uint32_t start = arch_get_cpu_cycle_count();
+  const bool dumped = dumper->dump(data);
+  dumper->get_profile_stats().record(arch_get_cpu_cycle_count() - start, dumped);
+#else
+  const bool dumped = dumper->dump(data);
+#endif
+  if (this->recording_ != nullptr && dumped && !dumper->is_secondary())
+    this->recording_->dumpers.push_back(dumper);
+  return dumped;
 }
 
 void RemoteReceiverBase::call_listeners_() {
-  for (auto *listener : this->listeners_)
-    listener->on_receive(RemoteReceiveData(this->temp_, this->tolerance_));
+  for (auto it = this->listeners_.begin(); it != this->listeners_.end(); ++it) {
+    if (!this->call_listener_(*it) || !this->exclusive_listeners_)
+      continue;
+    // move the listener that claimed the frame to the front so the most active one is tried first next time
+    std::rotate(this->listeners_.begin(), it, it + 1);
+    break;
+  }
 }
 
-void RemoteReceiverBase::call_dumpers_() {
+void RemoteReceiverBase::call_dumpers_(const RemoteReceiveData &data) {
   bool success = false;
   for (auto *dumper : this->dumpers_) {
-    if (dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_)))
+    if (this->call_dumper_(dumper, data))
       success = true;
   }
   if (!success) {
     for (auto *dumper : this->secondary_dumpers_)
-      dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_));
+      this->call_dumper_(dumper, data);
   }
+  if (data.get_repeats() != 0 && !this->dumpers_.empty())
+    ESP_LOGI(TAG, "  repeated %" PRIu32 " more times", data.get_repeats());
 }
 
+#ifdef USE_REMOTE_DEFERRED_DUMPS
+RemoteDumpQueue *global_remote_dump_queue = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void RemoteDumpQueue::setup() {
+  this->frames_.resize(this->max_frames_);
+  global_remote_dump_queue = this;
+}
+
+void RemoteDumpQueue::dump_config() {
+  ESP_LOGCONFIG(TAG, "Remote Dump Queue:");
+  ESP_LOGCONFIG(TAG, "  Max frames: %u", this->max_frames_);
+}
+
+void RemoteDumpQueue::push(RemoteReceiverBase *receiver, const RemoteReceiveData &data) {
+  if (this->count_ == this->frames_.size()) {
+    this->dropped_frames_++;
+    return;
+  }
+  Frame &frame = this->frames_[(this->head_ + this->count_) % this->frames_.size()];
+  frame.receiver = receiver;
+  // reuses the capacity left from earlier frames in this slot
+  frame.timings.assign(data.begin(), data.end());
+  frame.carrier_frequency = data.get_carrier_frequency();
+  frame.repeats = data.get_repeats();
+  frame.fingerprint = data.get_fingerprint();
+  frame.tolerance = data.get_tolerance();
+  this->count_++;
+}
+
+void RemoteDumpQueue::loop() {
+  while (this->count_ != 0) {
+    const Frame &frame = this->frames_[this->head_];
+    RemoteReceiveData data(frame.timings, frame.tolerance, frame.carrier_frequency);
+    data.set_segment(0, frame.timings.size(), frame.repeats);
+    data.set_fingerprint(frame.fingerprint);
+    frame.receiver->dump_frame(data);
+    this->head_ = (this->head_ + 1) % this->frames_.size();
+    this->count_--;
+  }
+}
+#endif
+
+#ifdef USE_REMOTE_RECEIVER_PROFILING
+static std::vector<RemoteProfileStats *> &profile_stats() {
+  static std::vector<RemoteProfileStats *> stats;
+  return stats;
+}
+
+const std::vector<RemoteProfileStats *> &all_profile_stats() { return profile_stats(); }
+
+void RemoteProfileStats::set_name(const char *name) {
+  if (this->name_ == nullptr)
+    profile_stats().push_back(this);
+  this->name_ = name;
+}
+
+void RemoteProfileStats::record(uint32_t cycles, bool hit) {
+  this->attempts_++;
+  if (hit)
+    this->hits_++;
+  this->total_cycles_ += cycles;
+  this->max_cycles_ = std::max(this->max_cycles_, cycles);
+  uint8_t bucket = 0;
+  for (cycles >>= HISTOGRAM_SHIFT; cycles != 0 && bucket + 1 < HISTOGRAM_BUCKETS; cycles >>= 1)
+    bucket++;
+  this->histogram_[bucket]++;
+}
+
+void RemoteReceiverProfiler::dump_config() {
+  ESP_LOGCONFIG(TAG, "Remote Receiver Profiler:");
+  ESP_LOGCONFIG(TAG, "  Profiled listeners and dumpers: %u", (unsigned) profile_stats().size());
+  LOG_UPDATE_INTERVAL(this);
+}
+
+void RemoteReceiverProfiler::update() {
+  ESP_LOGI(TAG, "Decode profile (in CPU cycles, histogram buckets double from %u):",
+           1u << RemoteProfileStats::HISTOGRAM_SHIFT);
+  for (auto *stats : profile_stats()) {
+    const uint32_t average = stats->get_attempts() == 0 ? 0 : stats->get_total_cycles() / stats->get_attempts();
+    char histogram[RemoteProfileStats::HISTOGRAM_BUCKETS * 11 + 1];
+    size_t offset = 0;
+    for (uint8_t i = 0; i < RemoteProfileStats::HISTOGRAM_BUCKETS; i++)
+      offset += snprintf(histogram + offset, sizeof(histogram) - offset, " %" PRIu32, stats->get_histogram()[i]);
+    ESP_LOGI(TAG, "  %-16s attempts=%" PRIu32 " hits=%" PRIu32 " rejects=%" PRIu32 " avg=%" PRIu32 " max=%" PRIu32,
+             stats->get_name(), stats->get_attempts(), stats->get_hits(), stats->get_rejects(), average,
+             stats->get_max_cycles());
+    ESP_LOGI(TAG, "  %-16s histogram:%s", "", histogram);
+  }
+}
+#endif
+
 void RemoteReceiverBinarySensorBase::dump_config() { LOG_BINARY_SENSOR("", "Remote Receiver Binary Sensor", this); }
 
 void RemoteTransmitterBase::send_(uint32_t send_times, uint32_t send_wait) {
@@ -157,7 +677,67 @@ void RemoteTransmitterBase::send_(uint32_t send_times, uint32_t send_wait) {
     ESP_LOGVV(TAG, "%s", buffer);
   }
 #endif
+#ifdef USE_REMOTE_CAPTURE
+  if (global_remote_capture_sink != nullptr)
+    global_remote_capture_sink->record_frame(true, this->temp_.get_carrier_frequency(), this->temp_.get_data());
+#endif
+  if (send_times == 0) {
+    this->looped_ = this->temp_;
+    this->looping_ = true;
+    this->resume_loop_ = false;
+  } else if (this->looping_) {
+    // this frame stops the loop at its next frame boundary; start it again once nothing else is waiting
+    this->looping_ = false;
+    this->resume_loop_ = true;
+  }
   this->send_internal(send_times, send_wait);
+  // transmitters that send in the background return while the frame is still on air
+  this->transmit_end_ = micros();
+  if (send_times != 0 && this->is_transmitting_())
+    this->transmit_end_ += send_times * this->temp_.get_duration() + (send_times - 1) * send_wait;
+}
+
+uint32_t RemoteTransmitterBase::get_remaining_transmit_time() {
+  if (!this->is_transmitting_())
+    return 0;
+  const int32_t remaining = this->transmit_end_ - micros();
+  return remaining > 0 ? remaining : 0;
+}
+
+void RemoteTransmitterBase::queue_(uint32_t coalesce_key, uint8_t priority, uint32_t send_times,
+                                   uint32_t send_wait) {
+  auto it = this->pending_.end();
+  if (coalesce_key != 0) {
+    it = std::find_if(this->pending_.begin(), this->pending_.end(),
+                      [coalesce_key](const PendingFrame &frame) { return frame.coalesce_key == coalesce_key; });
+  }
+  if (it != this->pending_.end() && it->priority == priority) {
+    ESP_LOGV(TAG, "Replacing queued frame with key 0x%08" PRIX32, coalesce_key);
+    it->send_times = send_times;
+    it->send_wait = send_wait;
+    it->data = this->temp_;
+    return;
+  }
+  if (it != this->pending_.end())
+    this->pending_.erase(it);
+  auto pos = std::find_if(this->pending_.begin(), this->pending_.end(),
+                          [priority](const PendingFrame &frame) { return frame.priority < priority; });
+  this->pending_.insert(pos, {coalesce_key, priority, send_times, send_wait, this->temp_});
+}
+
+void RemoteTransmitterBase::send_pending_() {
+  if ((this->pending_.empty() && !this->resume_loop_) || this->is_transmitting_())
+    return;
+  if (this->pending_.empty()) {
+    ESP_LOGV(TAG, "Resuming looped frame");
+    std::swap(this->temp_, this->looped_);
+    this->send_(0, 0);
+    return;
+  }
+  auto &frame = this->pending_.front();
+  std::swap(this->temp_, frame.data);
+  this->send_(frame.send_times, frame.send_wait);
+  this->pending_.erase(this->pending_.begin());
 }
 }  // namespace remote_base
 }  // namespace esphome
@@ -1,10 +1,18 @@
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <initializer_list>
+#include <memory>
+#include <tuple>
 #include <utility>
 #include <vector>
 
 #pragma once
 
 #include "esphome/core/component.h"
+#include "esphome/core/defines.h"
 #include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/automation.h"
 #include "esphome/components/binary_sensor/binary_sensor.h"
 
@@ -19,38 +27,170 @@ using RawTimings = std::vector<int32_t>;
 
 class RemoteTransmitData {
  public:
-  void mark(uint32_t length) { this->data_.push_back(length); }
-  void space(uint32_t length) { this->data_.push_back(-length); }
+  void mark(uint32_t length) {
+    this->data_.push_back(length);
+    this->account_(length, true);
+  }
+  void space(uint32_t length) {
+    this->data_.push_back(-length);
+    this->account_(length, false);
+  }
   void item(uint32_t mark, uint32_t space) {
     this->mark(mark);
     this->space(space);
   }
+  /// Append a mark (length > 0) or a space (length < 0); one of the same kind as the last timing lengthens that one
+  /// instead, and 0 appends nothing.
+  void extend(int32_t length) {
+    if (length == 0)
+      return;
+    if (this->data_.empty() || (this->data_.back() < 0) != (length < 0)) {
+      if (length > 0) {
+        this->mark(length);
+      } else {
+        this->space(-length);
+      }
+      return;
+    }
+    const uint32_t last = std::abs(this->data_.back());
+    const uint32_t added = std::abs(length);
+    this->duration_ += added;
+    this->rmt_durations_ += this->rmt_durations_of_(last + added) - this->rmt_durations_of_(last);
+    this->data_.back() += length;
+  }
   void reserve(uint32_t len) { this->data_.reserve(len); }
   void set_carrier_frequency(uint32_t carrier_frequency) { this->carrier_frequency_ = carrier_frequency; }
   uint32_t get_carrier_frequency() const { return this->carrier_frequency_; }
   const RawTimings &get_data() const { return this->data_; }
-  void set_data(const RawTimings &data) { this->data_ = data; }
+  void set_data(const RawTimings &data);
   void reset() {
     this->data_.clear();
     this->carrier_frequency_ = 0;
+    this->duration_ = 0;
+    this->edges_ = 0;
+    this->rmt_durations_ = 0;
   }
 
+  /// Total time the frame occupies the air, in µs.
+  uint32_t get_duration() const { return this->duration_; }
+  /// Number of level changes in the frame, not counting carrier edges.
+  uint32_t get_edge_count() const { return this->edges_; }
+  /// Number of RMT items the frame encodes to with the clock divider set by set_rmt_clock_divider().
+  uint32_t get_rmt_item_count() const { return (this->rmt_durations_ + 1) / 2; }
+  /// RMT clock divider used to work out the item count; 0 if the frame is not sent with the RMT.
+  void set_rmt_clock_divider(uint8_t clock_divider) { this->rmt_clock_divider_ = clock_divider; }
+
  protected:
+  void account_(uint32_t length, bool level) {
+    this->duration_ += length;
+    if (this->edges_ == 0 || level != this->level_)
+      this->edges_++;
+    this->level_ = level;
+    this->rmt_durations_ += this->rmt_durations_of_(length);
+  }
+  uint32_t rmt_durations_of_(uint32_t length) const {
+    if (this->rmt_clock_divider_ == 0)
+      return 1;
+    // an RMT item holds two durations of at most 32767 ticks each; longer ones are split
+    const uint32_t ticks = length * (80000000u / this->rmt_clock_divider_ / 100000u) / 10;
+    return ticks == 0 ? 1 : (ticks + 32766) / 32767;
+  }
+
   RawTimings data_{};
   uint32_t carrier_frequency_{0};
+  uint32_t duration_{0};
+  uint32_t edges_{0};
+  uint32_t rmt_durations_{0};
+  uint8_t rmt_clock_divider_{0};
+  bool level_{false};
+};
+
+/// Vector with a capacity fixed at compile time and its elements stored inline, so protocol payloads of varying
+/// length need no heap allocation. Elements beyond the capacity are dropped.
+template<typename T, size_t N> class StaticVector {
+ public:
+  StaticVector() = default;
+  StaticVector(std::initializer_list<T> values) { this->assign_(values.begin(), values.end()); }
+  StaticVector(const std::vector<T> &values) { this->assign_(values.begin(), values.end()); }  // NOLINT
+
+  /// Append value; if the vector is full, drop it, mark the vector as overflowed and return false.
+  bool push_back(const T &value) {
+    if (this->size_ == N) {
+      this->overflowed_ = true;
+      return false;
+    }
+    this->data_[this->size_++] = value;
+    return true;
+  }
+  void clear() {
+    this->size_ = 0;
+    this->overflowed_ = false;
+  }
+  /// Whether values were dropped for lack of room since the vector was last cleared or assigned.
+  bool overflowed() const { return this->overflowed_; }
+  size_t size() const { return this->size_; }
+  bool empty() const { return this->size_ == 0; }
+  static constexpr size_t capacity() { return N; }
+
+  T &operator[](size_t index) { return this->data_[index]; }
+  const T &operator[](size_t index) const { return this->data_[index]; }
+  T *data() { return this->data_; }
+  const T *data() const { return this->data_; }
+  T *begin() { return this->data_; }
+  T *end() { return this->data_ + this->size_; }
+  const T *begin() const { return this->data_; }
+  const T *end() const { return this->data_ + this->size_; }
+
+  bool operator==(const StaticVector &rhs) const {
+    return this->size_ == rhs.size_ && std::equal(this->begin(), this->end(), rhs.begin());
+  }
+
+ protected:
+  template<typename I> void assign_(I first, I last) {
+    this->clear();
+    for (; first != last; ++first)
+      this->push_back(*first);
+  }
+
+  T data_[N]{};
+  size_t size_{0};
+  bool overflowed_{false};
+};
+
+/// Shortest and longest mark and space of a received frame and its total duration, in µs
+struct RemoteFrameSummary {
+  uint32_t min_mark{UINT32_MAX};
+  uint32_t max_mark{0};
+  uint32_t min_space{UINT32_MAX};
+  uint32_t max_space{0};
+  uint32_t duration{0};
 };
 
 class RemoteReceiveData {
  public:
-  explicit RemoteReceiveData(const RawTimings &data, uint8_t tolerance)
-      : data_(data), index_(0), tolerance_(tolerance) {}
+  explicit RemoteReceiveData(const RawTimings &data, uint8_t tolerance, uint32_t carrier_frequency = 0)
+      : data_(data), index_(0), tolerance_(tolerance), carrier_frequency_(carrier_frequency), size_(data.size()) {}
 
+  /// The whole receive buffer; begin() and end() give just the segment being decoded.
   const RawTimings &get_raw_data() const { return this->data_; }
+  RawTimings::const_iterator begin() const { return this->data_.begin() + this->begin_; }
+  RawTimings::const_iterator end() const { return this->begin() + this->size_; }
   uint32_t get_index() const { return index_; }
-  int32_t operator[](uint32_t index) const { return this->data_[index]; }
-  int32_t size() const { return this->data_.size(); }
-  bool is_valid(uint32_t offset) const { return this->index_ + offset < this->data_.size(); }
-  int32_t peek(uint32_t offset = 0) const { return this->data_[this->index_ + offset]; }
+  uint8_t get_tolerance() const { return this->tolerance_; }
+  /// Carrier frequency the frame was sent with, in Hz; 0 if unknown.
+  uint32_t get_carrier_frequency() const { return this->carrier_frequency_; }
+  /// How many identical copies of this segment directly followed it in the receive buffer.
+  uint32_t get_repeats() const { return this->repeats_; }
+  /// Hash of the quantized timings, see fingerprint_timings(); 0 if the receiver has no fingerprint cache.
+  uint32_t get_fingerprint() const { return this->fingerprint_; }
+  void set_fingerprint(uint32_t fingerprint) { this->fingerprint_ = fingerprint; }
+  /// Number of the segment on its receiver, the same for every listener and dumper it's handed to; 0 if unknown.
+  uint32_t get_frame_id() const { return this->frame_id_; }
+  void set_frame_id(uint32_t frame_id) { this->frame_id_ = frame_id; }
+  int32_t operator[](uint32_t index) const { return this->data_[this->begin_ + index]; }
+  int32_t size() const { return this->size_; }
+  bool is_valid(uint32_t offset) const { return this->index_ + offset < this->size_; }
+  int32_t peek(uint32_t offset = 0) const { return this->data_[this->begin_ + this->index_ + offset]; }
   bool peek_mark(uint32_t length, uint32_t offset = 0) const;
   bool peek_space(uint32_t length, uint32_t offset = 0) const;
   bool peek_space_at_least(uint32_t length, uint32_t offset = 0) const;
@@ -65,6 +205,25 @@ class RemoteReceiveData {
   void advance(uint32_t amount = 1) { this->index_ += amount; }
   void reset() { this->index_ = 0; }
 
+  /// Restrict decoding to size timings of the buffer starting at begin, without copying them.
+  void set_segment(uint32_t begin, uint32_t size, uint32_t repeats) {
+    this->begin_ = begin;
+    this->size_ = size;
+    this->repeats_ = repeats;
+    this->index_ = 0;
+  }
+  void set_summary(const RemoteFrameSummary *summary) { this->summary_ = summary; }
+  /// False if the frame has no mark of this length, for rejecting it before decoding; always true without a summary.
+  bool may_have_mark(uint32_t length) const {
+    return this->summary_ == nullptr || (this->summary_->max_mark >= uint32_t(this->lower_bound_(length)) &&
+                                         this->summary_->min_mark <= uint32_t(this->upper_bound_(length)));
+  }
+  /// False if the frame has no space of this length, for rejecting it before decoding; always true without a summary.
+  bool may_have_space(uint32_t length) const {
+    return this->summary_ == nullptr || (this->summary_->max_space >= uint32_t(this->lower_bound_(length)) &&
+                                         this->summary_->min_space <= uint32_t(this->upper_bound_(length)));
+  }
+
  protected:
   int32_t lower_bound_(uint32_t length) const { return int32_t(100 - this->tolerance_) * length / 100U; }
   int32_t upper_bound_(uint32_t length) const { return int32_t(100 + this->tolerance_) * length / 100U; }
@@ -72,8 +231,31 @@ class RemoteReceiveData {
   const RawTimings &data_;
   uint32_t index_;
   uint8_t tolerance_;
+  uint32_t carrier_frequency_;
+  uint32_t begin_{0};
+  uint32_t size_;
+  uint32_t repeats_{0};
+  uint32_t fingerprint_{0};
+  uint32_t frame_id_{0};
+  const RemoteFrameSummary *summary_{nullptr};
 };
 
+/// Estimate the carrier frequency (in Hz) of a frame captured without demodulation, where every mark shows up as a
+/// burst of short carrier pulses. Returns 0 if the frame does not contain enough carrier pulses.
+uint32_t estimate_carrier_frequency(const RawTimings &data);
+/// Collapse the carrier bursts of a non-demodulated capture into single marks, in place.
+void collapse_carrier(RawTimings &data, uint32_t carrier_frequency);
+/// Fold marks and spaces shorter than threshold µs into the pulses around them, in place.
+void merge_glitches(RawTimings &data, uint32_t threshold);
+/// Shortest and longest mark and space, and total duration, of the timings from begin to end.
+RemoteFrameSummary summarize_frame(RawTimings::const_iterator begin, RawTimings::const_iterator end);
+/// Hash of the timings from begin to end, each rounded to a quarter octave so that frames within tolerance of each
+/// other usually get the same one. Never 0.
+uint32_t fingerprint_timings(RawTimings::const_iterator begin, RawTimings::const_iterator end);
+/// Write length bytes as dot separated hex digits to buffer, which needs room for 3 characters per byte (and one if
+/// length is 0); for logging payloads without building a string on the heap.
+void format_hex_dotted(char *buffer, const uint8_t *data, size_t length);
+
 class RemoteComponentBase {
  public:
   explicit RemoteComponentBase(InternalGPIOPin *pin) : pin_(pin){};
@@ -89,8 +271,19 @@ class RemoteRMTChannel {
 
   void config_rmt(rmt_config_t &rmt);
   void set_clock_divider(uint8_t clock_divider) { this->clock_divider_ = clock_divider; }
+  /// Largest frame, in RMT items, this channel has to hold; unused memory blocks go to the channels that need them
+  /// most. Must be set before the first channel is configured.
+  void set_max_frame_items(uint32_t max_frame_items) { this->max_frame_items_ = max_frame_items; }
+  rmt_channel_t get_channel() const { return this->channel_; }
+  uint8_t get_mem_block_num() const { return this->mem_block_num_; }
+
+  /// Log how channels and memory blocks were shared out between all RMT users.
+  static void dump_rmt_allocation();
 
  protected:
+  /// Assigns channels and memory blocks to all RMT users, once all of them have been constructed.
+  static void allocate_();
+
   uint32_t from_microseconds_(uint32_t us) {
     const uint32_t ticks_per_ten_us = 80000000u / this->clock_divider_ / 100000u;
     return us * ticks_per_ten_us / 10;
@@ -101,6 +294,7 @@ class RemoteRMTChannel {
   }
   RemoteComponentBase *remote_base_;
   rmt_channel_t channel_{RMT_CHANNEL_0};
+  uint32_t max_frame_items_{0};
   uint8_t mem_block_num_;
   uint8_t clock_divider_{80};
 };
@@ -115,12 +309,27 @@ class RemoteTransmitterBase : public RemoteComponentBase {
     RemoteTransmitData *get_data() { return &this->parent_->temp_; }
     void set_send_times(uint32_t send_times) { send_times_ = send_times; }
     void set_send_wait(uint32_t send_wait) { send_wait_ = send_wait; }
-    void perform() { this->parent_->send_(this->send_times_, this->send_wait_); }
+    /// Queue the frame instead of sending it right away; a queued frame with the same (non-zero) key is replaced, so
+    /// only the latest one goes on air.
+    void set_coalesce_key(uint32_t coalesce_key) { coalesce_key_ = coalesce_key; }
+    /// Queued frames are sent highest priority first; a frame is queued anyway if one with the same or a higher
+    /// priority is already waiting, so it can't overtake that one.
+    void set_priority(uint8_t priority) { priority_ = priority; }
+    void perform() {
+      if (this->coalesce_key_ != 0 ||
+          (this->parent_->has_pending_frames() && this->priority_ <= this->parent_->pending_priority_())) {
+        this->parent_->queue_(this->coalesce_key_, this->priority_, this->send_times_, this->send_wait_);
+      } else {
+        this->parent_->send_(this->send_times_, this->send_wait_);
+      }
+    }
 
    protected:
     RemoteTransmitterBase *parent_;
     uint32_t send_times_{1};
     uint32_t send_wait_{0};
+    uint32_t coalesce_key_{0};
+    uint8_t priority_{0};
   };
 
   TransmitCall transmit() {
@@ -128,48 +337,276 @@ class RemoteTransmitterBase : public RemoteComponentBase {
     return TransmitCall(this);
   }
 
+  /// Whether frames are queued, waiting for the transmitter's loop() to send them
+  bool has_pending_frames() const { return !this->pending_.empty(); }
+  /// µs until the frame last sent is off the air; transmitters that block while sending return once it is, so 0.
+  uint32_t get_remaining_transmit_time();
+
  protected:
   void send_(uint32_t send_times, uint32_t send_wait);
   virtual void send_internal(uint32_t send_times, uint32_t send_wait) = 0;
   void send_single_() { this->send_(1, 0); }
+  /// Queue the frame in temp_ behind all frames of at least the same priority, replacing a queued frame with the
+  /// same (non-zero) coalesce_key
+  void queue_(uint32_t coalesce_key, uint8_t priority, uint32_t send_times, uint32_t send_wait);
+  /// Priority of the next queued frame, or 0 if there is none
+  uint8_t pending_priority_() const { return this->pending_.empty() ? 0 : this->pending_.front().priority; }
+  /// Send the next queued frame, or resume an interrupted looped frame once the queue is empty, unless a
+  /// transmission is still on air; called from the transmitter's loop()
+  void send_pending_();
+  /// Whether a previous transmission is still on air, during which queued frames can still be replaced
+  virtual bool is_transmitting_() { return false; }
+
+  struct PendingFrame {
+    uint32_t coalesce_key;
+    uint8_t priority;
+    uint32_t send_times;
+    uint32_t send_wait;
+    RemoteTransmitData data;
+  };
 
   /// Use same vector for all transmits, avoids many allocations
   RemoteTransmitData temp_;
+  /// Frames waiting for the transmitter, highest priority first, then in the order they were first queued
+  std::vector<PendingFrame> pending_;
+  /// The last looped frame, sent again after other frames have stopped it at a frame boundary
+  RemoteTransmitData looped_;
+  bool looping_{false};
+  bool resume_loop_{false};
+  /// micros() at which the frame last sent is off the air
+  uint32_t transmit_end_{0};
+};
+
+#ifdef USE_REMOTE_CAPTURE
+/// Gets a copy of every frame sent or received by a remote transmitter or receiver
+class RemoteCaptureSink {
+ public:
+  virtual void record_frame(bool transmit, uint32_t carrier_frequency, const RawTimings &timings) = 0;
+};
+
+/// Where frames are recorded, nullptr for nowhere
+extern RemoteCaptureSink *global_remote_capture_sink;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#endif
+
+#ifdef USE_REMOTE_RECEIVER_PROFILING
+/// Call counts and CPU cycle histogram of one receiver listener or dumper
+class RemoteProfileStats {
+ public:
+  static const uint8_t HISTOGRAM_BUCKETS = 12;
+  /// Calls taking fewer than 2^HISTOGRAM_SHIFT cycles land in the first bucket, each further bucket doubles that
+  static const uint8_t HISTOGRAM_SHIFT = 10;
+
+  /// Name the stats after their protocol and add them to all_profile_stats()
+  void set_name(const char *name);
+  void record(uint32_t cycles, bool hit);
+
+  const char *get_name() const { return this->name_; }
+  uint32_t get_attempts() const { return this->attempts_; }
+  uint32_t get_hits() const { return this->hits_; }
+  uint32_t get_rejects() const { return this->attempts_ - this->hits_; }
+  uint64_t get_total_cycles() const { return this->total_cycles_; }
+  uint32_t get_max_cycles() const { return this->max_cycles_; }
+  const uint32_t *get_histogram() const { return this->histogram_; }
+
+ protected:
+  const char *name_{nullptr};
+  uint32_t attempts_{0};
+  uint32_t hits_{0};
+  uint64_t total_cycles_{0};
+  uint32_t max_cycles_{0};
+  uint32_t histogram_[HISTOGRAM_BUCKETS]{};
+};
+
+/// All named stats, in the order they were named
+const std::vector<RemoteProfileStats *> &all_profile_stats();
+
+/// Logs the stats of all listeners and dumpers every update interval
+class RemoteReceiverProfiler : public PollingComponent {
+ public:
+  void update() override;
+  void dump_config() override;
 };
+#endif
 
 class RemoteReceiverListener {
  public:
   virtual bool on_receive(RemoteReceiveData data) = 0;
+  /// Called instead of on_receive() for a frame with the fingerprint of one this listener claimed shortly before.
+  /// Decodes it again by default; listeners that kept the result can emit that instead.
+  virtual bool on_repeat(RemoteReceiveData data) { return this->on_receive(data); }
+  /// Listeners that act on frames without ever claiming them still get the repeats.
+  virtual bool wants_every_frame() const { return false; }
+  /// The RemoteReceiverDecoder with this key (see RemoteReceiverDecoder::key()) among the decoders of this
+  /// listener, so a dumper of the same protocol can use its decodes; nullptr if there is none.
+  virtual void *find_decoder(const void * /*key*/) { return nullptr; }
+  /// Ignore frames with the fingerprint of one decoded shortly before.
+  void set_suppress_repeats(bool suppress_repeats) { this->suppress_repeats_ = suppress_repeats; }
+  bool get_suppress_repeats() const { return this->suppress_repeats_; }
+#ifdef USE_REMOTE_RECEIVER_PROFILING
+  void set_profile_name(const char *name) { this->profile_stats_.set_name(name); }
+  RemoteProfileStats &get_profile_stats() { return this->profile_stats_; }
+#endif
+
+ protected:
+  bool suppress_repeats_{false};
+#ifdef USE_REMOTE_RECEIVER_PROFILING
+  RemoteProfileStats profile_stats_;
+#endif
 };
 
 class RemoteReceiverDumperBase {
  public:
   virtual bool dump(RemoteReceiveData src) = 0;
   virtual bool is_secondary() { return false; }
+  /// Take decodes from listener instead of decoding frames again, if it has a decoder of the same protocol.
+  virtual bool share_decodes(RemoteReceiverListener * /*listener*/) { return false; }
+#ifdef USE_REMOTE_RECEIVER_PROFILING
+  void set_profile_name(const char *name) { this->profile_stats_.set_name(name); }
+  RemoteProfileStats &get_profile_stats() { return this->profile_stats_; }
+
+ protected:
+  RemoteProfileStats profile_stats_;
+#endif
 };
 
 class RemoteReceiverBase : public RemoteComponentBase {
  public:
   RemoteReceiverBase(InternalGPIOPin *pin) : RemoteComponentBase(pin) {}
-  void register_listener(RemoteReceiverListener *listener) { this->listeners_.push_back(listener); }
+  void register_listener(RemoteReceiverListener *listener);
   void register_dumper(RemoteReceiverDumperBase *dumper);
   void set_tolerance(uint8_t tolerance) { tolerance_ = tolerance; }
+  /// Carrier frequency hint in Hz, passed on to decoders (for example for Pronto codes). 0 means unknown.
+  void set_carrier_frequency(uint32_t carrier_frequency) { this->carrier_frequency_ = carrier_frequency; }
+  /// The input is not demodulated: measure the carrier of each frame and collapse it into marks before decoding.
+  void set_detect_carrier(bool detect_carrier) { this->detect_carrier_ = detect_carrier; }
+  /// Stop dispatching a frame once a listener has claimed it and keep listeners ordered by most recent match.
+  void set_exclusive_listeners(bool exclusive_listeners) { this->exclusive_listeners_ = exclusive_listeners; }
+  /// Merge marks and spaces shorter than this (in µs) into their neighbours before decoding; 0 disables.
+  void set_glitch_threshold(uint32_t glitch_threshold) { this->glitch_threshold_ = glitch_threshold; }
+  /// Drop frames with fewer marks and spaces than this as noise.
+  void set_min_frame_timings(uint32_t min_frame_timings) { this->min_frame_timings_ = min_frame_timings; }
+  /// Drop frames as noise when their timings don't fit into this many lengths (within tolerance); 0 disables.
+  /// Protocols use a handful of different lengths, while noise has all sorts of them.
+  void set_max_distinct_timings(uint8_t max_distinct_timings) {
+    this->max_distinct_timings_ = std::min<uint8_t>(max_distinct_timings, MAX_DISTINCT_TIMINGS);
+  }
+  /// Number of frames dropped as noise so far
+  uint32_t get_noise_frames() const { return this->noise_frames_; }
+  /// Split each receive buffer after spaces of at least this many µs and decode every part on its own, collapsing
+  /// identical consecutive parts into one with a repeat count; 0 decodes the whole buffer as one frame.
+  void set_segment_gap(uint32_t segment_gap) { this->segment_gap_ = segment_gap; }
+  /// Remember which listeners and dumpers took a frame for this many ms, and hand frames with the same fingerprint
+  /// only to those, without trying every decoder again; 0 disables.
+  void set_fingerprint_timeout(uint32_t fingerprint_timeout) { this->fingerprint_timeout_ = fingerprint_timeout; }
+  /// Frames looked up in the fingerprint cache, and how many of them were found
+  uint32_t get_fingerprint_lookups() const { return this->fingerprint_lookups_; }
+  uint32_t get_fingerprint_hits() const { return this->fingerprint_hits_; }
+  float get_fingerprint_hit_rate() const {
+    return this->fingerprint_lookups_ == 0 ? 0.0f : float(this->fingerprint_hits_) / this->fingerprint_lookups_;
+  }
+  /// Hand a frame to the dumpers; frames are dumped through here later when dumps are deferred.
+  void dump_frame(const RemoteReceiveData &data) { this->call_dumpers_(data); }
 
  protected:
+  struct FingerprintEntry {
+    uint32_t fingerprint{0};
+    uint32_t last_seen{0};
+    /// Listeners that claimed the frame (or want every frame) and dumpers that dumped it; an entry without room for
+    /// all of them is not replayed
+    StaticVector<RemoteReceiverListener *, 4> listeners;
+    StaticVector<RemoteReceiverDumperBase *, 4> dumpers;
+  };
+
   void call_listeners_();
-  void call_dumpers_();
-  void call_listeners_dumpers_() {
-    this->call_listeners_();
-    this->call_dumpers_();
-  }
+  void call_dumpers_(const RemoteReceiveData &data);
+  void call_listeners_dumpers_();
+  bool call_listener_(RemoteReceiverListener *listener, bool repeat = false);
+  bool call_dumper_(RemoteReceiverDumperBase *dumper, const RemoteReceiveData &data);
+  /// Data of the segment being dispatched
+  RemoteReceiveData segment_data_() const;
+  /// Dump the segment being dispatched, now or through the dump queue
+  void dump_segment_();
+  bool is_noise_() const;
+  /// End (exclusive) of the segment starting at begin
+  uint32_t segment_end_(uint32_t begin) const;
+  bool same_segment_(uint32_t a_begin, uint32_t a_end, uint32_t b_begin, uint32_t b_end) const;
+  void dispatch_segment_(uint32_t begin, uint32_t end, uint32_t repeats);
+  /// Entry of a recent frame with this fingerprint, or nullptr
+  FingerprintEntry *find_fingerprint_(uint32_t fingerprint, uint32_t now);
+  void replay_(const FingerprintEntry &entry);
+
+  static constexpr uint8_t MAX_DISTINCT_TIMINGS = 32;
+  static constexpr uint8_t FINGERPRINT_CACHE_SIZE = 4;
 
   std::vector<RemoteReceiverListener *> listeners_;
   std::vector<RemoteReceiverDumperBase *> dumpers_;
   std::vector<RemoteReceiverDumperBase *> secondary_dumpers_;
   RawTimings temp_;
   uint8_t tolerance_;
+  bool detect_carrier_{false};
+  bool exclusive_listeners_{false};
+  uint32_t carrier_frequency_{0};
+  uint32_t frame_carrier_frequency_{0};
+  uint32_t glitch_threshold_{0};
+  uint32_t min_frame_timings_{0};
+  uint32_t noise_frames_{0};
+  uint8_t max_distinct_timings_{0};
+  uint32_t segment_gap_{0};
+  /// Segment of temp_ being dispatched
+  uint32_t segment_begin_{0};
+  uint32_t segment_size_{0};
+  uint32_t segment_repeats_{0};
+  uint32_t segment_fingerprint_{0};
+  uint32_t fingerprint_timeout_{0};
+  uint32_t fingerprint_lookups_{0};
+  uint32_t fingerprint_hits_{0};
+  FingerprintEntry fingerprint_cache_[FINGERPRINT_CACHE_SIZE];
+  /// Entry the frame being dispatched is recorded into, if any
+  FingerprintEntry *recording_{nullptr};
+  /// Summary of the frame being dispatched, handed to decoders with it
+  RemoteFrameSummary frame_summary_;
+  /// Number of the segment being dispatched, never 0
+  uint32_t frame_id_{0};
+};
+
+#ifdef USE_REMOTE_DEFERRED_DUMPS
+/// Runs the dumpers of all receivers from loop() instead of right after a frame arrives, so slow logging doesn't
+/// hold up the listeners or the next frame. Frames arriving while the queue is full are not dumped.
+class RemoteDumpQueue : public Component {
+ public:
+  void set_max_frames(uint8_t max_frames) { this->max_frames_ = max_frames; }
+  uint32_t get_dropped_frames() const { return this->dropped_frames_; }
+
+  void setup() override;
+  void loop() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::DATA; }
+
+  /// Copy the frame for dumping by receiver later
+  void push(RemoteReceiverBase *receiver, const RemoteReceiveData &data);
+
+ protected:
+  struct Frame {
+    RemoteReceiverBase *receiver;
+    RawTimings timings;
+    uint32_t carrier_frequency;
+    uint32_t repeats;
+    uint32_t fingerprint;
+    uint8_t tolerance;
+  };
+
+  /// Ring of frames waiting to be dumped
+  std::vector<Frame> frames_;
+  uint8_t head_{0};
+  uint8_t count_{0};
+  uint8_t max_frames_{4};
+  uint32_t dropped_frames_{0};
 };
 
+/// Where receivers queue their dumps, nullptr to dump right away
+extern RemoteDumpQueue *global_remote_dump_queue;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#endif
+
 class RemoteReceiverBinarySensorBase : public binary_sensor::BinarySensorInitiallyOff,
                                        public Component,
                                        public RemoteReceiverListener {
@@ -178,6 +615,14 @@ class RemoteReceiverBinarySensorBase : public binary_sensor::BinarySensorInitial
   void dump_config() override;
   virtual bool matches(RemoteReceiveData src) = 0;
   bool on_receive(RemoteReceiveData src) override;
+  /// Only called for repeats of a frame this sensor matched, so there's nothing to decode
+  bool on_repeat(RemoteReceiveData /*src*/) override {
+    this->publish_match_();
+    return true;
+  }
+
+ protected:
+  void publish_match_();
 };
 
 /* TEMPLATES */
@@ -186,6 +631,14 @@ template<typename T> class RemoteProtocol {
  public:
   virtual void encode(RemoteTransmitData *dst, const T &data) = 0;
   virtual optional<T> decode(RemoteReceiveData src) = 0;
+  /// Decode src into out, whose storage protocols with heap-backed data reuse; false if src isn't a frame of this.
+  virtual bool decode_into(RemoteReceiveData src, T *out) {
+    auto res = this->decode(src);
+    if (!res.has_value())
+      return false;
+    *out = std::move(*res);
+    return true;
+  }
   virtual void dump(const T &data) = 0;
 };
 
@@ -202,12 +655,20 @@ template<typename T, typename D> class RemoteReceiverBinarySensor : public Remot
 
  public:
   void set_data(D data) { data_ = data; }
+  /// Match against a frame that has already been decoded, see RemoteReceiverDispatcher.
+  bool on_decoded(const D &data) {
+    if (!(data == this->data_))
+      return false;
+    this->publish_match_();
+    return true;
+  }
 
  protected:
   D data_;
 };
 
-template<typename T, typename D> class RemoteReceiverTrigger : public Trigger<D>, public RemoteReceiverListener {
+template<typename T, typename D>
+class RemoteReceiverTrigger : public Trigger<const D &>, public RemoteReceiverListener {
  protected:
   bool on_receive(RemoteReceiveData src) override {
     auto proto = T();
@@ -220,6 +681,159 @@ template<typename T, typename D> class RemoteReceiverTrigger : public Trigger<D>
   }
 };
 
+/// Decodes frames of one protocol and keeps the result of the last decode, so that whatever else is handed the same
+/// frame (a dumper, or the frame's repeats) doesn't need to decode it again. Results are decoded into two buffers
+/// that take turns, so data that lives on the heap (Pronto's string) stops allocating once they are large enough.
+template<typename T, typename D> class RemoteReceiverDecoder {
+ public:
+  /// Identifies decoders of this protocol, see RemoteReceiverListener::find_decoder().
+  static const void *key() {
+    static const uint8_t KEY = 0;
+    return &KEY;
+  }
+
+  /// Decode src, or take the result of the last decode if that was of the same frame; nullptr if src isn't a frame
+  /// of T. The result stays valid until the next decode.
+  const D *decode(const RemoteReceiveData &src) {
+    if (src.get_frame_id() == 0 || src.get_frame_id() != this->decoded_frame_) {
+      this->decoded_frame_ = src.get_frame_id();
+      // a frame that doesn't decode leaves the last result for repeats
+      this->decoded_ = T().decode_into(src, &this->spare_);
+      if (this->decoded_) {
+        std::swap(this->last_, this->spare_);
+        this->has_last_ = true;
+        this->last_fingerprint_ = src.get_fingerprint();
+      }
+    }
+    return this->decoded_ ? &this->last_ : nullptr;
+  }
+  /// Whether src has the fingerprint of the last frame decoded, whose result can be emitted again for it.
+  bool is_repeat(const RemoteReceiveData &src) const {
+    return this->has_last_ && src.get_fingerprint() == this->last_fingerprint_;
+  }
+
+ protected:
+  /// Take the last result as the decode of src, a repeat of the frame it came from.
+  const D &repeat_(const RemoteReceiveData &src) {
+    this->decoded_frame_ = src.get_frame_id();
+    this->decoded_ = true;
+    return this->last_;
+  }
+
+  /// Last decoded frame and its fingerprint, for repeats, and the buffer the next frame is decoded into
+  D last_{};
+  D spare_{};
+  bool has_last_{false};
+  uint32_t last_fingerprint_{0};
+  /// Frame decode() was last called for, and whether that gave last_
+  uint32_t decoded_frame_{0};
+  bool decoded_{false};
+};
+
+/// Decodes each frame once for the BinarySensors binary sensors and Triggers triggers of one protocol on a receiver,
+/// which codegen sizes it for, so they are held inline and called without virtual dispatch.
+template<typename T, typename D, size_t BinarySensors, size_t Triggers>
+class RemoteReceiverDispatcher final : public RemoteReceiverListener, public RemoteReceiverDecoder<T, D> {
+ public:
+  void add_binary_sensor(RemoteReceiverBinarySensor<T, D> *binary_sensor) {
+    if (this->binary_sensor_count_ < BinarySensors)
+      this->binary_sensors_[this->binary_sensor_count_++] = binary_sensor;
+  }
+  void add_trigger(Trigger<const D &> *trigger) {
+    if (this->trigger_count_ < Triggers)
+      this->triggers_[this->trigger_count_++] = trigger;
+  }
+
+  bool on_receive(RemoteReceiveData src) override {
+    const D *res = this->decode(src);
+    if (res == nullptr)
+      return false;
+    return this->emit_(*res, false);
+  }
+  /// Emit the result of the frame this is a repeat of again, instead of decoding it
+  bool on_repeat(RemoteReceiveData src) override {
+    if (!this->is_repeat(src))
+      return this->on_receive(src);
+    return this->emit_(this->repeat_(src), true);
+  }
+  void *find_decoder(const void *key) override {
+    return key == RemoteReceiverDecoder<T, D>::key() ? static_cast<RemoteReceiverDecoder<T, D> *>(this) : nullptr;
+  }
+
+ protected:
+  bool emit_(const D &data, bool repeat) {
+    bool claimed = this->trigger_count_ != 0;
+    for (size_t i = 0; i < this->binary_sensor_count_; i++) {
+      auto *binary_sensor = this->binary_sensors_[i];
+      if (repeat && binary_sensor->get_suppress_repeats())
+        continue;
+      if (binary_sensor->on_decoded(data))
+        claimed = true;
+    }
+    for (size_t i = 0; i < this->trigger_count_; i++)
+      this->triggers_[i]->trigger(data);
+    return claimed;
+  }
+
+  std::array<RemoteReceiverBinarySensor<T, D> *, BinarySensors> binary_sensors_{};
+  std::array<Trigger<const D &> *, Triggers> triggers_{};
+  uint8_t binary_sensor_count_{0};
+  uint8_t trigger_count_{0};
+};
+
+/// The dispatchers of all protocols the binary sensors and triggers of a receiver use, generated by codegen for each
+/// receiver. Registered as the receiver's only listener for those protocols, it hands every frame to each dispatcher
+/// through direct calls the compiler can inline.
+template<typename... Dispatchers> class RemoteReceiverDispatch : public RemoteReceiverListener {
+ public:
+  template<size_t I> typename std::tuple_element<I, std::tuple<Dispatchers...>>::type *get() {
+    return &std::get<I>(this->dispatchers_);
+  }
+
+  bool on_receive(RemoteReceiveData src) override {
+    bool claimed = false;
+    this->for_each_([&](auto &dispatcher) { claimed |= this->call_(dispatcher, src, false); });
+    return claimed;
+  }
+  /// Only the dispatchers that took the frame this is a repeat of get it, unless none of them remembers it
+  bool on_repeat(RemoteReceiveData src) override {
+    bool replayed = false;
+    bool claimed = false;
+    this->for_each_([&](auto &dispatcher) {
+      if (!dispatcher.is_repeat(src))
+        return;
+      replayed = true;
+      claimed |= this->call_(dispatcher, src, true);
+    });
+    return replayed ? claimed : this->on_receive(src);
+  }
+  void *find_decoder(const void *key) override {
+    void *decoder = nullptr;
+    this->for_each_([&](auto &dispatcher) {
+      if (decoder == nullptr)
+        decoder = dispatcher.find_decoder(key);
+    });
+    return decoder;
+  }
+
+ protected:
+  template<typename F> void for_each_(F &&func) {
+    std::apply([&](auto &...dispatchers) { (func(dispatchers), ...); }, this->dispatchers_);
+  }
+  template<typename Dispatcher> static bool call_(Dispatcher &dispatcher, const RemoteReceiveData &src, bool repeat) {
+#ifdef USE_REMOTE_RECEIVER_PROFILING
+    const uint32_t start = arch_get_cpu_cycle_count();
+    const bool claimed = repeat ? dispatcher.on_repeat(src) : dispatcher.on_receive(src);
+    dispatcher.get_profile_stats().record(arch_get_cpu_cycle_count() - start, claimed);
+    return claimed;
+#else
+    return repeat ? dispatcher.on_repeat(src) : dispatcher.on_receive(src);
+#endif
+  }
+
+  std::tuple<Dispatchers...> dispatchers_;
+};
+
 template<typename... Ts> class RemoteTransmitterActionBase : public Action<Ts...> {
  public:
   void set_parent(RemoteTransmitterBase *parent) { this->parent_ = parent; }
@@ -227,11 +841,58 @@ template<typename... Ts> class RemoteTransmitterActionBase : public Action<Ts...
   TEMPLATABLE_VALUE(uint32_t, send_times);
   TEMPLATABLE_VALUE(uint32_t, send_wait);
 
+  /// All values that go into the frame are constant: encode it once and replay the cached timings afterwards.
+  void set_static_encoding(bool static_encoding) { this->static_encoding_ = static_encoding; }
+  /// The frame was encoded at codegen time: send these timings (stored in flash) instead of calling encode().
+  void set_static_timings(const int32_t *timings, size_t len, uint32_t carrier_frequency) {
+    this->static_timings_ = timings;
+    this->static_timings_len_ = len;
+    this->static_carrier_frequency_ = carrier_frequency;
+  }
+
+  /// Encode the frame this action sends into dst, without sending it.
+  void encode_frame(RemoteTransmitData *dst, Ts... x) {
+    if (this->static_timings_ != nullptr) {
+      dst->reserve(this->static_timings_len_);
+      for (size_t i = 0; i < this->static_timings_len_; i++) {
+        const int32_t value = this->static_timings_[i];
+        if (value < 0) {
+          dst->space(static_cast<uint32_t>(-value));
+        } else {
+          dst->mark(static_cast<uint32_t>(value));
+        }
+      }
+      dst->set_carrier_frequency(this->static_carrier_frequency_);
+      return;
+    }
+    if (!this->static_encoding_) {
+      this->encode(dst, x...);
+      return;
+    }
+    if (this->encoded_ == nullptr) {
+      this->encoded_ = make_unique<RemoteTransmitData>();
+      this->encode(this->encoded_.get(), x...);
+    }
+    dst->set_data(this->encoded_->get_data());
+    dst->set_carrier_frequency(this->encoded_->get_carrier_frequency());
+  }
+  uint32_t get_send_times(Ts... x) { return this->send_times_.value_or(x..., 1); }
+  uint32_t get_send_wait(Ts... x) { return this->send_wait_.value_or(x..., 0); }
+
+  /// Frames sent with the same coalesce key replace each other until the transmitter gets to them.
+  void set_coalesce_key(uint32_t coalesce_key) { this->coalesce_key_ = coalesce_key; }
+  void set_priority(uint8_t priority) { this->priority_ = priority; }
+
   void play(Ts... x) override {
     auto call = this->parent_->transmit();
-    this->encode(call.get_data(), x...);
-    call.set_send_times(this->send_times_.value_or(x..., 1));
-    call.set_send_wait(this->send_wait_.value_or(x..., 0));
+    this->encode_frame(call.get_data(), x...);
+    // encoders refuse to send data they can't encode by leaving the frame empty
+    if (call.get_data()->get_data().empty())
+      return;
+    call.set_send_times(this->get_send_times(x...));
+    call.set_send_wait(this->get_send_wait(x...));
+    call.set_coalesce_key(this->coalesce_key_);
+    call.set_priority(this->priority_);
     call.perform();
   }
 
@@ -239,24 +900,143 @@ template<typename... Ts> class RemoteTransmitterActionBase : public Action<Ts...
   virtual void encode(RemoteTransmitData *dst, Ts... x) = 0;
 
   RemoteTransmitterBase *parent_{};
+  uint32_t coalesce_key_{0};
+  uint8_t priority_{0};
+  bool static_encoding_{false};
+  /// Allocated on the first play of a static action only
+  std::unique_ptr<RemoteTransmitData> encoded_;
+  const int32_t *static_timings_{nullptr};
+  size_t static_timings_len_{0};
+  uint32_t static_carrier_frequency_{0};
 };
 
+/// Sends the frames of several transmit actions with as few transmissions as possible. Consecutive frames that use
+/// the same carrier and are separated by no more than max_inline_gap are joined by a space and sent together; longer
+/// gaps are waited for without blocking.
+template<typename... Ts> class RemoteTransmitterMacroAction : public Action<Ts...>, public Component {
+ public:
+  void set_parent(RemoteTransmitterBase *parent) { this->parent_ = parent; }
+  /// Longest gap in µs that is sent as a space instead of being scheduled.
+  void set_max_inline_gap(uint32_t max_inline_gap) { this->max_inline_gap_ = max_inline_gap; }
+  /// Add the frame of action, followed by gap µs of silence before the next frame.
+  void add_frame(RemoteTransmitterActionBase<Ts...> *action, uint32_t gap) { this->frames_.push_back({action, gap}); }
+
+  float get_setup_priority() const override { return setup_priority::HARDWARE; }
+
+  /// Playing the macro again while it waits for a gap starts it over; the run it replaces never gets to the next
+  /// action.
+  void play_complex(Ts... x) override {
+    if (this->num_running_ > 0) {
+      this->cancel_timeout("macro");
+      this->num_running_--;
+    }
+    this->num_running_++;
+    this->send_from_(0, 0, x...);
+  }
+  void play(Ts... x) override { /* ignore - see play_complex */
+  }
+  void stop() override {
+    this->cancel_timeout("macro");
+    this->num_running_ = 0;
+  }
+
+ protected:
+  struct Frame {
+    RemoteTransmitterActionBase<Ts...> *action;
+    uint32_t gap;
+  };
+
+  void send_from_(size_t index, uint32_t repeat, Ts... x) {
+    auto call = this->parent_->transmit();
+    auto *dst = call.get_data();
+    uint32_t gap = 0;  // gap between the last frame in dst and the next one
+    while (index < this->frames_.size()) {
+      auto *action = this->frames_[index].action;
+      this->frame_.reset();
+      action->encode_frame(&this->frame_, x...);
+      if (dst->get_data().empty()) {
+        dst->set_carrier_frequency(this->frame_.get_carrier_frequency());
+      } else if (gap > this->max_inline_gap_ || this->frame_.get_carrier_frequency() != dst->get_carrier_frequency()) {
+        break;
+      } else {
+        // a frame ending with a space gets the gap added to it, and without a gap its last mark runs into the first
+        // one of the next frame
+        dst->extend(-int32_t(gap));
+      }
+      for (int32_t item : this->frame_.get_data())
+        dst->extend(item);
+      // repeats of an action are frames of their own, separated by its send_wait
+      if (++repeat < action->get_send_times(x...)) {
+        gap = action->get_send_wait(x...);
+      } else {
+        gap = this->frames_[index].gap;
+        repeat = 0;
+        index++;
+      }
+    }
+    if (!dst->get_data().empty())
+      call.perform();
+
+    if (index >= this->frames_.size()) {
+      this->play_next_(x...);
+      return;
+    }
+    this->wait_gap_(index, repeat, gap, x...);
+  }
+
+  /// Send the frames from index once the frame just handed to the transmitter is off the air and gap µs have passed.
+  /// perform() may return while it's still queued or, on ESP32, still being sent.
+  void wait_gap_(size_t index, uint32_t repeat, uint32_t gap, Ts... x) {
+    if (this->parent_->has_pending_frames()) {
+      this->set_timeout("macro", 1, [this, index, repeat, gap, x...]() { this->wait_gap_(index, repeat, gap, x...); });
+      return;
+    }
+    const uint32_t wait = this->parent_->get_remaining_transmit_time() + gap;
+    this->set_timeout("macro", (wait + 999) / 1000,
+                      [this, index, repeat, x...]() { this->send_from_(index, repeat, x...); });
+  }
+
+  RemoteTransmitterBase *parent_{};
+  uint32_t max_inline_gap_{0};
+  std::vector<Frame> frames_;
+  RemoteTransmitData frame_;
+};
+
+/// Dumps frames of one protocol; if the receiver has a dispatcher for it, the frames that one decoded already are
+/// not decoded again.
 template<typename T, typename D> class RemoteReceiverDumper : public RemoteReceiverDumperBase {
  public:
   bool dump(RemoteReceiveData src) override {
-    auto proto = T();
-    auto decoded = proto.decode(src);
-    if (!decoded.has_value())
+    if (this->decoder_ == nullptr) {
+      // nothing to share decodes with: decode into buffers of its own, made once
+      this->own_decoder_ = make_unique<RemoteReceiverDecoder<T, D>>();
+      this->decoder_ = this->own_decoder_.get();
+    }
+    const D *decoded = this->decoder_->decode(src);
+    if (decoded == nullptr)
       return false;
-    proto.dump(*decoded);
+    T().dump(*decoded);
     return true;
   }
+  bool share_decodes(RemoteReceiverListener *listener) override {
+    void *decoder = listener->find_decoder(RemoteReceiverDecoder<T, D>::key());
+    if (decoder == nullptr)
+      return false;
+    this->decoder_ = static_cast<RemoteReceiverDecoder<T, D> *>(decoder);
+    return true;
+  }
+
+ protected:
+  RemoteReceiverDecoder<T, D> *decoder_{nullptr};
+  std::unique_ptr<RemoteReceiverDecoder<T, D>> own_decoder_;
 };
 
 #define DECLARE_REMOTE_PROTOCOL_(prefix) \
   using prefix##BinarySensor = RemoteReceiverBinarySensor<prefix##Protocol, prefix##Data>; \
   using prefix##Trigger = RemoteReceiverTrigger<prefix##Protocol, prefix##Data>; \
-  using prefix##Dumper = RemoteReceiverDumper<prefix##Protocol, prefix##Data>;
+  using prefix##Dumper = RemoteReceiverDumper<prefix##Protocol, prefix##Data>; \
+  template<size_t BinarySensors, size_t Triggers> \
+  using prefix##Dispatcher = RemoteReceiverDispatcher<prefix##Protocol, prefix##Data, BinarySensors, Triggers>;
 #define DECLARE_REMOTE_PROTOCOL(prefix) DECLARE_REMOTE_PROTOCOL_(prefix)
 
 }  // namespace remote_base
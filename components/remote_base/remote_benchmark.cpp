@@ -0,0 +1,175 @@
+#include "remote_benchmark.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <cinttypes>
+#include <cmath>
+
+namespace esphome {
+namespace remote_base {
+
+static const char *const TAG = "remote_base.benchmark";
+
+static const uint8_t NOISE_MIN_TIMINGS = 8;
+static const uint8_t NOISE_MAX_TIMINGS = 120;
+static const uint32_t NOISE_MIN_DURATION = 50;
+static const uint32_t NOISE_MAX_DURATION = 10000;
+static const uint32_t GLITCH_MIN_DURATION = 5;
+static const uint32_t GLITCH_MAX_DURATION = 30;
+/// Idle time that ends a captured frame, remote_receiver's default
+static const int32_t IDLE_DURATION = 10000;
+
+void RemoteBenchmark::generate_noise_() {
+  this->noise_generated_ = true;
+  for (uint32_t i = 0; i < this->noise_frames_; i++) {
+    RawTimings frame;
+    const size_t count = NOISE_MIN_TIMINGS + random_uint32() % (NOISE_MAX_TIMINGS - NOISE_MIN_TIMINGS + 1);
+    frame.reserve(count);
+    for (size_t j = 0; j < count; j++) {
+      const int32_t duration = NOISE_MIN_DURATION + random_uint32() % (NOISE_MAX_DURATION - NOISE_MIN_DURATION + 1);
+      frame.push_back(j % 2 == 0 ? duration : -duration);
+    }
+    this->frames_.push_back(std::move(frame));
+  }
+}
+
+void RemoteBenchmark::run() {
+  if (!this->noise_generated_)
+    this->generate_noise_();
+  if (this->frames_.empty()) {
+    ESP_LOGW(TAG, "No frames to decode");
+    return;
+  }
+
+  ESP_LOGI(TAG, "Decoding %u frames %" PRIu32 " times with %u decoders:", (unsigned) this->frames_.size(),
+           this->iterations_, (unsigned) this->decoders_.size());
+  uint32_t total_us = 0;
+  for (const auto &decoder : this->decoders_) {
+    uint32_t hits = 0;
+    const uint32_t start = micros();
+    for (uint32_t i = 0; i < this->iterations_; i++) {
+      for (const auto &frame : this->frames_) {
+        if (decoder.decode(RemoteReceiveData(frame, this->tolerance_)))
+          hits++;
+      }
+      App.feed_wdt();
+    }
+    const uint32_t elapsed_us = std::max<uint32_t>(micros() - start, 1);
+    total_us += elapsed_us;
+    const uint32_t decodes = this->iterations_ * this->frames_.size();
+    ESP_LOGI(TAG, "  %-16s %8" PRIu32 " frames/s %8" PRIu32 " ns/decode  hits %" PRIu32 "/%u per pass", decoder.name,
+             uint32_t(uint64_t(decodes) * 1000000 / elapsed_us), uint32_t(uint64_t(elapsed_us) * 1000 / decodes),
+             hits / this->iterations_, (unsigned) this->frames_.size());
+  }
+  const uint64_t frames = uint64_t(this->iterations_) * this->frames_.size();
+  ESP_LOGI(TAG, "All decoders: %" PRIu32 " frames/s", uint32_t(frames * 1000000 / std::max<uint32_t>(total_us, 1)));
+}
+
+/// Standard normal random number (Box-Muller)
+static float random_gaussian() {
+  const float u1 = std::max(random_float(), 1e-6f);
+  const float u2 = random_float();
+  return sqrtf(-2.0f * logf(u1)) * cosf(2.0f * float(M_PI) * u2);
+}
+
+bool RemoteRoundTrip::timings_match(RawTimings timings, RawTimings expected, uint8_t tolerance) {
+  merge_glitches(timings, 0);
+  merge_glitches(expected, 0);
+  if (timings.size() < expected.size())
+    return false;
+  for (size_t i = 0; i < expected.size(); i++) {
+    if ((timings[i] < 0) != (expected[i] < 0))
+      return false;
+    const uint32_t length = std::abs(timings[i]);
+    const uint32_t expected_length = std::abs(expected[i]);
+    if (length < (100 - tolerance) * expected_length / 100)
+      return false;
+    const bool last_space = i + 1 == expected.size() && expected[i] < 0;
+    if (!last_space && length > (100 + tolerance) * expected_length / 100)
+      return false;
+  }
+  return true;
+}
+
+void RemoteRoundTrip::capture(RawTimings *timings, bool inverted) {
+  if (inverted) {
+    for (int32_t &timing : *timings)
+      timing = -timing;
+  }
+  timings->push_back(-IDLE_DURATION);
+  merge_glitches(*timings, 0);
+}
+
+void RemoteRoundTrip::disturb(const RawTimings &src, uint32_t jitter, bool inverted, RawTimings *dst) {
+  dst->clear();
+  for (int32_t timing : src) {
+    const bool mark = timing >= 0;
+    const int32_t duration = std::max<int32_t>(std::abs(timing) + lroundf(random_gaussian() * jitter), 1);
+    dst->push_back(mark ? duration : -duration);
+  }
+  if (!dst->empty() && random_uint32() % 100 < this->glitch_probability_) {
+    // split a random mark in two with a short space
+    size_t index = random_uint32() % dst->size();
+    if ((*dst)[index] < 0)
+      index = index == 0 ? 1 : index - 1;
+    if (index < dst->size() && (*dst)[index] >= 2) {
+      const int32_t mark = (*dst)[index];
+      const int32_t glitch = GLITCH_MIN_DURATION + random_uint32() % (GLITCH_MAX_DURATION - GLITCH_MIN_DURATION + 1);
+      const int32_t first = 1 + random_uint32() % (mark - 1);
+      (*dst)[index] = first;
+      dst->insert(dst->begin() + index + 1, {-glitch, std::max<int32_t>(mark - first - glitch, 1)});
+    }
+  }
+  capture(dst, inverted);
+}
+
+void RemoteRoundTrip::run_(const char *name, CheckFunction check, bool inverted, const EncodeFunction &encode) {
+  const std::vector<uint32_t> jitters = this->jitters_.empty() ? std::vector<uint32_t>{0} : this->jitters_;
+  const std::vector<uint8_t> tolerances = this->tolerances_.empty() ? std::vector<uint8_t>{25} : this->tolerances_;
+  // successes for each tolerance (outer) and jitter (inner)
+  std::vector<uint32_t> successes(tolerances.size() * jitters.size());
+  RemoteTransmitData clean;
+  RawTimings expected;
+  RawTimings disturbed;
+  uint32_t encode_us = 0;
+  uint32_t check_us = 0;
+  uint32_t checks = 0;
+
+  for (uint32_t i = 0; i < this->iterations_; i++) {
+    clean.reset();
+    uint32_t start = micros();
+    encode(&clean);
+    encode_us += micros() - start;
+    expected = clean.get_data();
+    capture(&expected, inverted);
+    for (size_t j = 0; j < jitters.size(); j++) {
+      this->disturb(clean.get_data(), jitters[j], inverted, &disturbed);
+      for (size_t t = 0; t < tolerances.size(); t++) {
+        start = micros();
+        if (check(RemoteReceiveData(disturbed, tolerances[t]), expected))
+          successes[t * jitters.size() + j]++;
+        check_us += micros() - start;
+        checks++;
+      }
+    }
+    App.feed_wdt();
+  }
+
+  ESP_LOGI(TAG, "Round trip %s: %" PRIu32 " frames, %" PRIu32 " ns/encode, %" PRIu32 " ns/check", name,
+           this->iterations_, uint32_t(uint64_t(encode_us) * 1000 / std::max<uint32_t>(this->iterations_, 1)),
+           uint32_t(uint64_t(check_us) * 1000 / std::max<uint32_t>(checks, 1)));
+  for (size_t t = 0; t < tolerances.size(); t++) {
+    char line[256];
+    size_t offset = snprintf(line, sizeof(line), "  tolerance %3u%%:", tolerances[t]);
+    for (size_t j = 0; j < jitters.size() && offset < sizeof(line); j++) {
+      offset += snprintf(line + offset, sizeof(line) - offset, " %" PRIu32 "us %3" PRIu32 "%%", jitters[j],
+                         successes[t * jitters.size() + j] * 100 / std::max<uint32_t>(this->iterations_, 1));
+    }
+    ESP_LOGI(TAG, "%s", line);
+  }
+}
+
+}  // namespace remote_base
+}  // namespace esphome
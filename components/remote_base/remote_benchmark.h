@@ -0,0 +1,131 @@
+#pragma once
+
+#include "esphome/core/automation.h"
+#include "remote_base.h"
+
+#include <functional>
+#include <vector>
+
+namespace esphome {
+namespace remote_base {
+
+/// Runs decoders over a corpus of frames and logs how long they take and how often they match
+class RemoteBenchmark {
+ public:
+  using DecodeFunction = bool (*)(RemoteReceiveData src);
+
+  template<typename T> void add_protocol(const char *name) {
+    this->decoders_.push_back({name, [](RemoteReceiveData src) { return T().decode(src).has_value(); }});
+  }
+  void add_frame(const int32_t *frame, size_t len) { this->frames_.emplace_back(frame, frame + len); }
+  /// Add count frames of random timings, for the cost of rejecting noise
+  void set_noise_frames(uint32_t noise_frames) { this->noise_frames_ = noise_frames; }
+  void set_iterations(uint32_t iterations) { this->iterations_ = iterations; }
+  void set_tolerance(uint8_t tolerance) { this->tolerance_ = tolerance; }
+
+  /// Decode every frame iterations times with each decoder and log the results; blocks until done
+  void run();
+
+ protected:
+  struct Decoder {
+    const char *name;
+    DecodeFunction decode;
+  };
+
+  void generate_noise_();
+
+  std::vector<Decoder> decoders_;
+  std::vector<RawTimings> frames_;
+  uint32_t noise_frames_{0};
+  uint32_t iterations_{1};
+  uint8_t tolerance_{25};
+  bool noise_generated_{false};
+};
+
+template<typename... Ts> class RemoteBenchmarkAction : public Action<Ts...>, public RemoteBenchmark {
+ public:
+  void play(Ts... x) override { this->run(); }
+};
+
+/// Encodes frames, disturbs their timings with Gaussian jitter and glitches and decodes them again, then logs the
+/// share of frames that survived for each tolerance and jitter level along with encode and check times
+class RemoteRoundTrip {
+ public:
+  /// Whether src decodes to a frame that encodes to the expected timings
+  using CheckFunction = bool (*)(RemoteReceiveData src, const RawTimings &expected);
+  using EncodeFunction = std::function<void(RemoteTransmitData *dst)>;
+
+  void set_iterations(uint32_t iterations) { this->iterations_ = iterations; }
+  /// Standard deviations in µs of the jitter added to every timing; each is a point of the logged curve
+  void add_jitter(uint32_t jitter) { this->jitters_.push_back(jitter); }
+  void add_tolerance(uint8_t tolerance) { this->tolerances_.push_back(tolerance); }
+  /// Chance in percent that a frame gets a mark split by a short space
+  void set_glitch_probability(uint8_t glitch_probability) { this->glitch_probability_ = glitch_probability; }
+
+  /// Whether src decodes to the data expected, the undisturbed frame as captured, decodes to
+  template<typename T> static bool round_trips(RemoteReceiveData src, const RawTimings &expected) {
+    auto decoded = T().decode(src);
+    if (!decoded.has_value())
+      return false;
+    auto wanted = T().decode(RemoteReceiveData(expected, src.get_tolerance()));
+    return wanted.has_value() && *decoded == *wanted;
+  }
+  /// Check of lossy protocols like Pronto, whose data holds the received timings: src must decode to data that
+  /// re-encodes to expected within the tolerance of src
+  template<typename T> static bool round_trips_within(RemoteReceiveData src, const RawTimings &expected) {
+    auto decoded = T().decode(src);
+    if (!decoded.has_value())
+      return false;
+    RemoteTransmitData encoded;
+    T().encode(&encoded, *decoded);
+    return timings_match(encoded.get_data(), expected, src.get_tolerance());
+  }
+  /// Whether timings are expected within tolerance percent once adjacent marks and spaces are joined; the last space
+  /// of expected only has to be as long, as a receiver runs it into its idle time
+  static bool timings_match(RawTimings timings, RawTimings expected, uint8_t tolerance);
+
+  /// Turn encoded timings into what a receiver captures: adjacent marks and spaces joined and the frame ended by an
+  /// idle gap; inverted for protocols decoded from an inverted pin
+  static void capture(RawTimings *timings, bool inverted);
+  /// Jitter each timing of src, maybe add a glitch, and capture the result into dst
+  void disturb(const RawTimings &src, uint32_t jitter, bool inverted, RawTimings *dst);
+
+ protected:
+  void run_(const char *name, CheckFunction check, bool inverted, const EncodeFunction &encode);
+
+  uint32_t iterations_{100};
+  std::vector<uint32_t> jitters_;
+  std::vector<uint8_t> tolerances_;
+  uint8_t glitch_probability_{0};
+};
+
+template<typename... Ts> class RemoteRoundTripAction : public Action<Ts...>, public RemoteRoundTrip {
+ public:
+  /// Round-trip the frames of action, decoding them with protocol T; see round_trips_within() for lossy ones
+  template<typename T>
+  void add_frame(RemoteTransmitterActionBase<Ts...> *action, const char *name, bool lossy = false,
+                 bool inverted = false) {
+    this->frames_.push_back(
+        {action, name, lossy ? &RemoteRoundTrip::round_trips_within<T> : &RemoteRoundTrip::round_trips<T>, inverted});
+  }
+
+  void play(Ts... x) override {
+    for (const auto &frame : this->frames_)
+      this->run_(frame.name, frame.check, frame.inverted, [&frame, &x...](RemoteTransmitData *dst) {
+        frame.action->encode_frame(dst, x...);
+      });
+  }
+
+ protected:
+  struct Frame {
+    RemoteTransmitterActionBase<Ts...> *action;
+    const char *name;
+    CheckFunction check;
+    bool inverted;
+  };
+
+  std::vector<Frame> frames_;
+};
+
+}  // namespace remote_base
+}  // namespace esphome
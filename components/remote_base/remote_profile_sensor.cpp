@@ -0,0 +1,55 @@
+#include "remote_profile_sensor.h"
+
+#if defined(USE_REMOTE_RECEIVER_PROFILING) && defined(USE_SENSOR)
+
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace remote_base {
+
+static const char *const TAG = "remote_base.profile";
+
+void RemoteProfileSensor::dump_config() {
+  ESP_LOGCONFIG(TAG, "Remote Profile Sensor:");
+  ESP_LOGCONFIG(TAG, "  Protocol: %s", this->protocol_);
+  LOG_SENSOR("  ", "Attempts", this->attempts_sensor_);
+  LOG_SENSOR("  ", "Hits", this->hits_sensor_);
+  LOG_SENSOR("  ", "Rejects", this->rejects_sensor_);
+  LOG_SENSOR("  ", "Average Cycles", this->average_cycles_sensor_);
+  LOG_SENSOR("  ", "Max Cycles", this->max_cycles_sensor_);
+  LOG_UPDATE_INTERVAL(this);
+}
+
+void RemoteProfileSensor::update() {
+  uint32_t attempts = 0;
+  uint32_t hits = 0;
+  uint64_t total_cycles = 0;
+  uint32_t max_cycles = 0;
+  for (auto *stats : all_profile_stats()) {
+    if (strcmp(stats->get_name(), this->protocol_) != 0)
+      continue;
+    attempts += stats->get_attempts();
+    hits += stats->get_hits();
+    total_cycles += stats->get_total_cycles();
+    max_cycles = std::max(max_cycles, stats->get_max_cycles());
+  }
+
+  if (this->attempts_sensor_ != nullptr)
+    this->attempts_sensor_->publish_state(attempts);
+  if (this->hits_sensor_ != nullptr)
+    this->hits_sensor_->publish_state(hits);
+  if (this->rejects_sensor_ != nullptr)
+    this->rejects_sensor_->publish_state(attempts - hits);
+  if (this->average_cycles_sensor_ != nullptr)
+    this->average_cycles_sensor_->publish_state(attempts == 0 ? 0.0f : float(total_cycles) / attempts);
+  if (this->max_cycles_sensor_ != nullptr)
+    this->max_cycles_sensor_->publish_state(max_cycles);
+}
+
+}  // namespace remote_base
+}  // namespace esphome
+
+#endif
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#if defined(USE_REMOTE_RECEIVER_PROFILING) && defined(USE_SENSOR)
+
+#include "esphome/core/component.h"
+#include "esphome/components/sensor/sensor.h"
+#include "remote_base.h"
+
+namespace esphome {
+namespace remote_base {
+
+/// Publishes the decode stats of all listeners and dumpers of one protocol, summed up
+class RemoteProfileSensor : public PollingComponent {
+ public:
+  void set_protocol(const char *protocol) { this->protocol_ = protocol; }
+  void set_attempts_sensor(sensor::Sensor *attempts_sensor) { this->attempts_sensor_ = attempts_sensor; }
+  void set_hits_sensor(sensor::Sensor *hits_sensor) { this->hits_sensor_ = hits_sensor; }
+  void set_rejects_sensor(sensor::Sensor *rejects_sensor) { this->rejects_sensor_ = rejects_sensor; }
+  void set_average_cycles_sensor(sensor::Sensor *average_cycles_sensor) {
+    this->average_cycles_sensor_ = average_cycles_sensor;
+  }
+  void set_max_cycles_sensor(sensor::Sensor *max_cycles_sensor) { this->max_cycles_sensor_ = max_cycles_sensor; }
+
+  void update() override;
+  void dump_config() override;
+
+ protected:
+  const char *protocol_{""};
+  sensor::Sensor *attempts_sensor_{nullptr};
+  sensor::Sensor *hits_sensor_{nullptr};
+  sensor::Sensor *rejects_sensor_{nullptr};
+  sensor::Sensor *average_cycles_sensor_{nullptr};
+  sensor::Sensor *max_cycles_sensor_{nullptr};
+};
+
+}  // namespace remote_base
+}  // namespace esphome
+
+#endif
@@ -1,6 +1,8 @@
 #include "samsung36_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_PROTOCOL_SAMSUNG36
+
 namespace esphome {
 namespace remote_base {
 
@@ -101,3 +103,5 @@ void Samsung36Protocol::dump(const Samsung36Data &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif
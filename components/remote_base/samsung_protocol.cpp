@@ -2,6 +2,8 @@
 #include "esphome/core/log.h"
 #include <cinttypes>
 
+#ifdef USE_REMOTE_PROTOCOL_SAMSUNG
+
 namespace esphome {
 namespace remote_base {
 
@@ -63,3 +65,5 @@ void SamsungProtocol::dump(const SamsungData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif
@@ -0,0 +1,58 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import sensor
+from esphome.const import (
+    CONF_ID,
+    CONF_PROTOCOL,
+    STATE_CLASS_MEASUREMENT,
+    STATE_CLASS_TOTAL_INCREASING,
+)
+from . import DUMPER_REGISTRY, remote_base_ns
+
+CONF_ATTEMPTS = "attempts"
+CONF_AVERAGE_CYCLES = "average_cycles"
+CONF_HITS = "hits"
+CONF_MAX_CYCLES = "max_cycles"
+CONF_REJECTS = "rejects"
+
+RemoteProfileSensor = remote_base_ns.class_("RemoteProfileSensor", cg.PollingComponent)
+
+COUNTER_SCHEMA = sensor.sensor_schema(
+    accuracy_decimals=0,
+    state_class=STATE_CLASS_TOTAL_INCREASING,
+)
+CYCLES_SCHEMA = sensor.sensor_schema(
+    unit_of_measurement="cycles",
+    accuracy_decimals=0,
+    state_class=STATE_CLASS_MEASUREMENT,
+)
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(RemoteProfileSensor),
+        cv.Required(CONF_PROTOCOL): cv.one_of(*DUMPER_REGISTRY.keys(), lower=True),
+        cv.Optional(CONF_ATTEMPTS): COUNTER_SCHEMA,
+        cv.Optional(CONF_HITS): COUNTER_SCHEMA,
+        cv.Optional(CONF_REJECTS): COUNTER_SCHEMA,
+        cv.Optional(CONF_AVERAGE_CYCLES): CYCLES_SCHEMA,
+        cv.Optional(CONF_MAX_CYCLES): CYCLES_SCHEMA,
+    }
+).extend(cv.polling_component_schema("60s"))
+
+
+async def to_code(config):
+    cg.add_define("USE_REMOTE_RECEIVER_PROFILING")
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    cg.add(var.set_protocol(config[CONF_PROTOCOL]))
+
+    for key in (
+        CONF_ATTEMPTS,
+        CONF_HITS,
+        CONF_REJECTS,
+        CONF_AVERAGE_CYCLES,
+        CONF_MAX_CYCLES,
+    ):
+        if key in config:
+            sens = await sensor.new_sensor(config[key])
+            cg.add(getattr(var, f"set_{key}_sensor")(sens))
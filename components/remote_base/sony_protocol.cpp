@@ -1,6 +1,8 @@
 #include "sony_protocol.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_REMOTE_PROTOCOL_SONY
+
 namespace esphome {
 namespace remote_base {
 
@@ -67,3 +69,5 @@ void SonyProtocol::dump(const SonyData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif
@@ -2,6 +2,8 @@
 #include "esphome/core/log.h"
 #include <cinttypes>
 
+#ifdef USE_REMOTE_PROTOCOL_TOSHIBA_AC
+
 namespace esphome {
 namespace remote_base {
 
@@ -113,3 +115,5 @@ void ToshibaAcProtocol::dump(const ToshibaAcData &data) {
 
 }  // namespace remote_base
 }  // namespace esphome
+
+#endif
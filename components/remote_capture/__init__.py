@@ -0,0 +1,45 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome import automation
+from esphome.const import CONF_ID
+
+AUTO_LOAD = ["remote_base"]
+
+CONF_BUFFER_SIZE = "buffer_size"
+CONF_STREAM = "stream"
+
+remote_capture_ns = cg.esphome_ns.namespace("remote_capture")
+RemoteCapture = remote_capture_ns.class_("RemoteCapture", cg.Component)
+DumpAction = remote_capture_ns.class_("DumpAction", automation.Action)
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(RemoteCapture),
+        cv.Optional(CONF_BUFFER_SIZE, default=4096): cv.int_range(
+            min=64, max=1048576
+        ),
+        cv.Optional(CONF_STREAM, default=True): cv.boolean,
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+async def to_code(config):
+    cg.add_define("USE_REMOTE_CAPTURE")
+    var = cg.new_Pvariable(config[CONF_ID], config[CONF_BUFFER_SIZE])
+    await cg.register_component(var, config)
+    cg.add(var.set_stream(config[CONF_STREAM]))
+
+
+@automation.register_action(
+    "remote_capture.dump",
+    DumpAction,
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.use_id(RemoteCapture),
+        }
+    ),
+)
+async def remote_capture_dump_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
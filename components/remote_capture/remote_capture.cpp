@@ -0,0 +1,148 @@
+#include "remote_capture.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#include <cinttypes>
+
+namespace esphome {
+namespace remote_capture {
+
+static const char *const TAG = "remote_capture";
+
+/// Records logged per loop iteration while streaming
+static const uint8_t RECORDS_PER_LOOP = 4;
+/// Record bytes per log line (256 characters of base64)
+static const size_t BYTES_PER_LINE = 192;
+
+static size_t varint_size(uint32_t value) {
+  size_t size = 1;
+  while (value >= 0x80) {
+    value >>= 7;
+    size++;
+  }
+  return size;
+}
+
+static uint32_t zigzag(int32_t value) { return (uint32_t(value) << 1) ^ uint32_t(value >> 31); }
+
+void RemoteCapture::setup() {
+  ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
+  this->buffer_ = allocator.allocate(this->buffer_size_);
+  if (this->buffer_ == nullptr) {
+    ESP_LOGE(TAG, "Could not allocate %u bytes for the capture buffer", (unsigned) this->buffer_size_);
+    this->mark_failed();
+    return;
+  }
+  remote_base::global_remote_capture_sink = this;
+}
+
+void RemoteCapture::dump_config() {
+  ESP_LOGCONFIG(TAG, "Remote Capture:");
+  ESP_LOGCONFIG(TAG, "  Buffer size: %u bytes", (unsigned) this->buffer_size_);
+  ESP_LOGCONFIG(TAG, "  Stream: %s", YESNO(this->stream_));
+}
+
+void RemoteCapture::loop() {
+  if (!this->stream_)
+    return;
+  for (uint8_t i = 0; i < RECORDS_PER_LOOP && this->used_ != 0; i++) {
+    this->pop_record_(true);
+    this->log_record_();
+  }
+}
+
+void RemoteCapture::dump() {
+  while (this->used_ != 0) {
+    this->pop_record_(true);
+    this->log_record_();
+  }
+}
+
+void RemoteCapture::record_frame(bool transmit, uint32_t carrier_frequency, const remote_base::RawTimings &timings) {
+  if (this->buffer_ == nullptr)
+    return;
+  const uint32_t now = micros();
+  size_t length = 1 + varint_size(now) + varint_size(carrier_frequency);
+  for (int32_t timing : timings)
+    length += varint_size(zigzag(timing));
+  const size_t total = varint_size(length) + length;
+  if (total > this->buffer_size_) {
+    this->dropped_++;
+    return;
+  }
+  while (this->buffer_size_ - this->used_ < total) {
+    this->pop_record_(false);
+    this->dropped_++;
+  }
+
+  this->push_varint_(length);
+  this->push_byte_(transmit ? 1 : 0);
+  this->push_varint_(now);
+  this->push_varint_(carrier_frequency);
+  for (int32_t timing : timings)
+    this->push_varint_(zigzag(timing));
+}
+
+void RemoteCapture::push_byte_(uint8_t value) {
+  this->buffer_[this->head_] = value;
+  this->head_ = (this->head_ + 1) % this->buffer_size_;
+  this->used_++;
+}
+
+void RemoteCapture::push_varint_(uint32_t value) {
+  while (value >= 0x80) {
+    this->push_byte_(uint8_t(value) | 0x80);
+    value >>= 7;
+  }
+  this->push_byte_(value);
+}
+
+uint8_t RemoteCapture::pop_byte_() {
+  const uint8_t value = this->buffer_[this->tail_];
+  this->tail_ = (this->tail_ + 1) % this->buffer_size_;
+  this->used_--;
+  return value;
+}
+
+uint32_t RemoteCapture::pop_varint_() {
+  uint32_t value = 0;
+  for (uint8_t shift = 0;; shift += 7) {
+    const uint8_t byte = this->pop_byte_();
+    value |= uint32_t(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0)
+      return value;
+  }
+}
+
+void RemoteCapture::pop_record_(bool keep) {
+  const uint32_t length = this->pop_varint_();
+  if (!keep) {
+    this->tail_ = (this->tail_ + length) % this->buffer_size_;
+    this->used_ -= length;
+    return;
+  }
+  // the length is logged with the record, so that the reader can check it arrived in one piece
+  this->record_.clear();
+  uint32_t value = length;
+  while (value >= 0x80) {
+    this->record_.push_back(uint8_t(value) | 0x80);
+    value >>= 7;
+  }
+  this->record_.push_back(value);
+  for (uint32_t i = 0; i < length; i++)
+    this->record_.push_back(this->pop_byte_());
+}
+
+void RemoteCapture::log_record_() {
+  if (this->dropped_ != 0) {
+    ESP_LOGW(TAG, "Dropped %" PRIu32 " records, the buffer was full", this->dropped_);
+    this->dropped_ = 0;
+  }
+  for (size_t offset = 0; offset < this->record_.size(); offset += BYTES_PER_LINE) {
+    const size_t size = std::min(BYTES_PER_LINE, this->record_.size() - offset);
+    ESP_LOGI(TAG, "%s %s", offset == 0 ? "CAP" : "CAP+", base64_encode(this->record_.data() + offset, size).c_str());
+  }
+}
+
+}  // namespace remote_capture
+}  // namespace esphome
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "esphome/core/automation.h"
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+#include "esphome/components/remote_base/remote_base.h"
+
+#include <vector>
+
+namespace esphome {
+namespace remote_capture {
+
+/// Records every frame sent or received into a ring buffer and streams the records out over the logger, as base64
+/// in lines starting with "CAP " (continued on lines starting with "CAP+ "). When the buffer is full, the oldest
+/// records are dropped. Recording and streaming both run from the main loop, so the buffer needs no locking.
+///
+/// A record is its length (varint, number of bytes that follow), flags (one byte, bit 0 set for transmitted frames),
+/// micros() when it was recorded (varint), the carrier frequency in Hz (varint, 0 if none or unknown) and then the
+/// timings in µs up to the end of the record (zigzag varints, marks positive and spaces negative). Varints are
+/// unsigned LEB128: 7 bits per byte, least significant group first, high bit set on all but the last byte.
+class RemoteCapture : public Component, public remote_base::RemoteCaptureSink {
+ public:
+  explicit RemoteCapture(size_t buffer_size) : buffer_size_(buffer_size) {}
+
+  void setup() override;
+  void loop() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::DATA; }
+
+  /// Log records as soon as they are captured; otherwise they are kept until dump() is called
+  void set_stream(bool stream) { this->stream_ = stream; }
+  /// Log all records in the buffer and remove them
+  void dump();
+
+  void record_frame(bool transmit, uint32_t carrier_frequency, const remote_base::RawTimings &timings) override;
+
+ protected:
+  void push_byte_(uint8_t value);
+  void push_varint_(uint32_t value);
+  uint8_t pop_byte_();
+  uint32_t pop_varint_();
+  /// Remove the oldest record from the buffer, copying it into record_ if keep is set
+  void pop_record_(bool keep);
+  void log_record_();
+
+  uint8_t *buffer_{nullptr};
+  size_t buffer_size_;
+  /// Next byte to write, oldest byte and number of bytes in use
+  size_t head_{0};
+  size_t tail_{0};
+  size_t used_{0};
+  /// Records that did not fit or were overwritten since the last report
+  uint32_t dropped_{0};
+  bool stream_{true};
+  std::vector<uint8_t> record_;
+};
+
+template<typename... Ts> class DumpAction : public Action<Ts...>, public Parented<RemoteCapture> {
+ public:
+  void play(Ts... x) override { this->parent_->dump(); }
+};
+
+}  // namespace remote_capture
+}  // namespace esphome
@@ -10,6 +10,10 @@ RemoteTransmitterComponent = remote_transmitter_ns.class_(
     "RemoteTransmitterComponent", remote_base.RemoteTransmitterBase, cg.Component
 )
 
+CONF_CARRIER_FREQUENCIES = "carrier_frequencies"
+CONF_MAX_FRAME_ITEMS = "max_frame_items"
+CONF_STREAMING = "streaming"
+
 MULTI_CONF = True
 CONFIG_SCHEMA = cv.Schema(
     {
@@ -18,6 +22,13 @@ CONFIG_SCHEMA = cv.Schema(
         cv.Required(CONF_CARRIER_DUTY_PERCENT): cv.All(
             cv.percentage_int, cv.Range(min=1, max=100)
         ),
+        cv.Optional(CONF_CARRIER_FREQUENCIES): cv.All(
+            cv.only_on_esp32, cv.ensure_list(cv.frequency)
+        ),
+        cv.Optional(CONF_MAX_FRAME_ITEMS): cv.All(
+            cv.only_on_esp32, cv.positive_not_null_int
+        ),
+        cv.Optional(CONF_STREAMING): cv.All(cv.only_on_esp32, cv.boolean),
     }
 ).extend(cv.COMPONENT_SCHEMA)
 
@@ -28,3 +39,12 @@ async def to_code(config):
     await cg.register_component(var, config)
 
     cg.add(var.set_carrier_duty_percent(config[CONF_CARRIER_DUTY_PERCENT]))
+
+    if CONF_MAX_FRAME_ITEMS in config:
+        cg.add(var.set_max_frame_items(config[CONF_MAX_FRAME_ITEMS]))
+
+    if CONF_STREAMING in config:
+        cg.add(var.set_streaming(config[CONF_STREAMING]))
+
+    for carrier_frequency in config.get(CONF_CARRIER_FREQUENCIES, []):
+        cg.add(var.add_carrier_channel(int(carrier_frequency)))
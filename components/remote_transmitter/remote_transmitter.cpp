@@ -7,5 +7,44 @@ namespace remote_transmitter {
 
 static const char *const TAG = "remote_transmitter";
 
+#if defined(USE_ESP8266) || defined(USE_LIBRETINY)
+void RemoteTransmitterComponent::transmit_frame_(uint32_t on_time, uint32_t off_time) {
+  const auto &data = this->temp_.get_data();
+  const bool modulate = this->carrier_duty_percent_ < 100 && (on_time > 0 || off_time > 0);
+  this->await_target_time_();
+  // every item ends at an absolute time counted from the start of the frame, so loop overhead does not accumulate
+  uint32_t end = this->target_time_;
+  for (int32_t item : data) {
+    end += item > 0 ? uint32_t(item) : uint32_t(-item);
+    this->await_target_time_();
+    if (item <= 0) {
+      this->write_pin_(false);
+    } else {
+      this->write_pin_(true);
+      if (modulate) {
+        // carrier edges are laid out from the start of the mark, so loop overhead does not accumulate
+        uint32_t edge = this->target_time_ + on_time;
+        while (edge < end) {
+          this->target_time_ = edge;
+          this->await_target_time_();
+          this->write_pin_(false);
+
+          edge += off_time;
+          if (edge >= end)
+            break;
+          this->target_time_ = edge;
+          this->await_target_time_();
+          this->write_pin_(true);
+          edge += on_time;
+        }
+      }
+    }
+    this->target_time_ = end;
+  }
+  this->await_target_time_();  // wait for duration of last pulse
+  this->write_pin_(false);
+}
+#endif
+
 }  // namespace remote_transmitter
 }  // namespace esphome
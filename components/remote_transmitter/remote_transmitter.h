@@ -20,6 +20,8 @@ class RemoteTransmitterComponent : public remote_base::RemoteTransmitterBase,
 
   void setup() override;
 
+  void loop() override { this->send_pending_(); }
+
   void dump_config() override;
 
   float get_setup_priority() const override { return setup_priority::DATA; }
@@ -28,6 +30,11 @@ class RemoteTransmitterComponent : public remote_base::RemoteTransmitterBase,
 
 #ifdef USE_ESP32
   void set_rmt_force_inverted(bool state);
+  /// Keep an extra RMT channel configured for this carrier frequency, so switching to it needs no reconfiguration.
+  void add_carrier_channel(uint32_t carrier_frequency);
+  /// Convert timings to RMT items on the fly while sending instead of buffering the whole frame; looped frames are
+  /// always buffered.
+  void set_streaming(bool streaming) { this->streaming_ = streaming; }
 #endif
 
  protected:
@@ -35,16 +42,51 @@ class RemoteTransmitterComponent : public remote_base::RemoteTransmitterBase,
 #if defined(USE_ESP8266) || defined(USE_LIBRETINY)
   void calculate_on_off_time_(uint32_t carrier_frequency, uint32_t *on_time_period, uint32_t *off_time_period);
 
-  void mark_(uint32_t on_time, uint32_t off_time, uint32_t usec);
-
-  void space_(uint32_t usec);
+  void transmit_frame_(uint32_t on_time, uint32_t off_time);
 
   void await_target_time_();
+  /// Drive the output from the transmit loop without going through the virtual GPIO interface
+  void write_pin_(bool value) {
+#ifdef USE_ESP8266
+    if (this->pin_mask_ != 0) {
+      *(value ? this->pin_set_reg_ : this->pin_clear_reg_) = this->pin_mask_;
+      return;
+    }
+#endif
+    this->isr_pin_.digital_write(value);
+  }
   uint32_t target_time_;
+  ISRInternalGPIOPin isr_pin_;
+#ifdef USE_ESP8266
+  /// GPIO output set/clear registers, swapped for inverted pins; pin_mask_ is 0 if the pin has none (GPIO16)
+  volatile uint32_t *pin_set_reg_{nullptr};
+  volatile uint32_t *pin_clear_reg_{nullptr};
+  uint32_t pin_mask_{0};
+#endif
 #endif
 
 #ifdef USE_ESP32
+  struct CarrierChannel {
+    remote_base::RemoteRMTChannel *channel;
+    uint32_t carrier_frequency;
+    bool initialized;
+  };
+
   void configure_rmt_();
+  void configure_carrier_channels_();
+  esp_err_t install_channel_(rmt_channel_t channel);
+  void encode_rmt_items_(uint32_t send_times, uint32_t send_wait);
+  void wait_tx_done_();
+  bool is_transmitting_() override;
+  static void translate_timings_(const void *src, rmt_item32_t *dest, size_t src_size, size_t wanted_num,
+                                 size_t *translated_size, size_t *item_num);
+  esp_err_t configure_channel_(remote_base::RemoteRMTChannel *channel, uint32_t carrier_frequency);
+  /// Route the output pin to channel through the GPIO matrix
+  void route_pin_(rmt_channel_t channel);
+  remote_base::RemoteRMTChannel *channel_for_(uint32_t carrier_frequency);
+
+  std::vector<CarrierChannel> carrier_channels_;
+  rmt_channel_t active_channel_{RMT_CHANNEL_0};
 
   uint32_t current_carrier_frequency_{UINT32_MAX};
   bool initialized_{false};
@@ -52,6 +94,15 @@ class RemoteTransmitterComponent : public remote_base::RemoteTransmitterBase,
   esp_err_t error_code_{ESP_OK};
   bool force_inverted_{false};
   bool inverted_{false};
+  bool streaming_{false};
+  /// A buffered transmission may still be running from rmt_temp_
+  bool tx_pending_{false};
+  /// Position of the translator when streaming: timing (data size means the gap between repeats), ticks of it already
+  /// handed to the RMT, repeats still to go and the gap between them
+  size_t stream_index_{0};
+  uint32_t stream_emitted_{0};
+  uint32_t stream_repeats_{0};
+  uint32_t stream_wait_{0};
 #endif
   uint8_t carrier_duty_percent_{50};
 };
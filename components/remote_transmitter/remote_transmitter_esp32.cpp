@@ -6,13 +6,19 @@
 
 #include "soc/gpio_periph.h"
 
+#include <cinttypes>
+
 namespace esphome {
 namespace remote_transmitter {
 
 static const char *const TAG = "remote_transmitter";
 static const uint16_t RMT_WAIT_TX_DONE_TIMEOUT = 500;
 
-void RemoteTransmitterComponent::setup() { this->configure_rmt_(); }
+void RemoteTransmitterComponent::setup() {
+  this->temp_.set_rmt_clock_divider(this->clock_divider_);
+  this->configure_rmt_();
+  this->configure_carrier_channels_();
+}
 
 void RemoteTransmitterComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "Remote Transmitter...");
@@ -24,6 +30,16 @@ void RemoteTransmitterComponent::dump_config() {
   if (this->current_carrier_frequency_ != 0 && this->carrier_duty_percent_ != 100) {
     ESP_LOGCONFIG(TAG, "    Carrier Duty: %u%%", this->carrier_duty_percent_);
   }
+  for (auto &carrier_channel : this->carrier_channels_) {
+    ESP_LOGCONFIG(TAG, "  Channel %d: %" PRIu32 " Hz carrier", carrier_channel.channel->get_channel(),
+                  carrier_channel.carrier_frequency);
+  }
+
+  static bool allocation_dumped = false;
+  if (!allocation_dumped) {
+    allocation_dumped = true;
+    remote_base::RemoteRMTChannel::dump_rmt_allocation();
+  }
 
   if (this->is_failed()) {
     ESP_LOGE(TAG, "Configuring RMT driver failed: %s", esp_err_to_name(this->error_code_));
@@ -31,18 +47,122 @@ void RemoteTransmitterComponent::dump_config() {
 }
 
 void RemoteTransmitterComponent::configure_rmt_() {
+  esp_err_t error = this->configure_channel_(this, this->current_carrier_frequency_);
+  if (error == ESP_OK && !this->initialized_) {
+    error = this->install_channel_(this->channel_);
+    this->initialized_ = error == ESP_OK;
+  }
+  if (error != ESP_OK) {
+    this->error_code_ = error;
+    this->mark_failed();
+    return;
+  }
+  this->active_channel_ = this->channel_;
+}
+
+void RemoteTransmitterComponent::configure_carrier_channels_() {
+  if (this->carrier_channels_.empty() || this->is_failed())
+    return;
+  for (auto &carrier_channel : this->carrier_channels_) {
+    carrier_channel.channel->set_clock_divider(this->clock_divider_);
+    esp_err_t error = this->configure_channel_(carrier_channel.channel, carrier_channel.carrier_frequency);
+    if (error == ESP_OK && !carrier_channel.initialized) {
+      error = this->install_channel_(carrier_channel.channel->get_channel());
+      carrier_channel.initialized = error == ESP_OK;
+    }
+    if (error != ESP_OK) {
+      this->error_code_ = error;
+      this->mark_failed();
+      return;
+    }
+  }
+  // configuring a channel routes the pin to it, hand it back
+  this->route_pin_(this->active_channel_);
+}
+
+esp_err_t RemoteTransmitterComponent::install_channel_(rmt_channel_t channel) {
+  esp_err_t error = rmt_driver_install(channel, 0, 0);
+  if (error != ESP_OK || !this->streaming_)
+    return error;
+  error = rmt_translator_init(channel, RemoteTransmitterComponent::translate_timings_);
+  if (error != ESP_OK)
+    return error;
+  return rmt_translator_set_context(channel, this);
+}
+
+void RemoteTransmitterComponent::translate_timings_(const void * /*src*/, rmt_item32_t *dest, size_t src_size,
+                                                    size_t wanted_num, size_t *translated_size, size_t *item_num) {
+  // timings are read from temp_ rather than src, so that repeats can be produced without copying the frame
+  RemoteTransmitterComponent *parent;
+  rmt_translator_get_context(item_num, reinterpret_cast<void **>(&parent));
+  const auto &data = parent->temp_.get_data();
+  size_t items = 0;
+  bool second_half = false;
+  bool done = false;
+  rmt_item32_t rmt_item;
+
+  while (items < wanted_num) {
+    if (parent->stream_index_ == data.size() && (parent->stream_repeats_ == 0 || parent->stream_wait_ == 0)) {
+      if (parent->stream_repeats_ == 0) {
+        done = true;
+        break;
+      }
+      parent->stream_index_ = 0;
+      parent->stream_repeats_--;
+    }
+    int32_t val = parent->stream_index_ < data.size() ? data[parent->stream_index_] : -int32_t(parent->stream_wait_);
+    bool level = val >= 0;
+    if (!level)
+      val = -val;
+    const uint32_t ticks = parent->from_microseconds_(static_cast<uint32_t>(val)) - parent->stream_emitted_;
+    const uint32_t item = std::min(ticks, uint32_t(32767));
+
+    if (!second_half) {
+      rmt_item.level0 = static_cast<uint32_t>(level ^ parent->inverted_);
+      rmt_item.duration0 = item;
+    } else {
+      rmt_item.level1 = static_cast<uint32_t>(level ^ parent->inverted_);
+      rmt_item.duration1 = item;
+      dest[items++] = rmt_item;
+    }
+    second_half = !second_half;
+
+    // a timing that does not fit into the space left is picked up again where it was left off next time
+    if (item != ticks) {
+      parent->stream_emitted_ += item;
+      continue;
+    }
+    parent->stream_emitted_ = 0;
+    if (++parent->stream_index_ > data.size()) {  // the gap is done, start the next repeat
+      parent->stream_index_ = 0;
+      parent->stream_repeats_--;
+    }
+  }
+
+  if (second_half) {
+    rmt_item.level1 = 0;
+    rmt_item.duration1 = 0;
+    dest[items++] = rmt_item;
+  }
+  // the driver stops asking for items once all of src is reported as translated
+  *translated_size = done ? src_size : 0;
+  *item_num = items;
+}
+
+esp_err_t RemoteTransmitterComponent::configure_channel_(remote_base::RemoteRMTChannel *channel,
+                                                         uint32_t carrier_frequency) {
   rmt_config_t c{};
 
-  this->config_rmt(c);
+  channel->config_rmt(c);
   c.rmt_mode = RMT_MODE_TX;
   c.gpio_num = gpio_num_t(this->pin_->get_pin());
   c.tx_config.loop_en = false;
 
-  if (this->current_carrier_frequency_ == 0 || this->carrier_duty_percent_ == 100) {
+  if (carrier_frequency == 0 || this->carrier_duty_percent_ == 100) {
     c.tx_config.carrier_en = false;
   } else {
     c.tx_config.carrier_en = true;
-    c.tx_config.carrier_freq_hz = this->current_carrier_frequency_;
+    c.tx_config.carrier_freq_hz = carrier_frequency;
     c.tx_config.carrier_duty_percent = this->carrier_duty_percent_;
   }
 
@@ -58,26 +178,35 @@ void RemoteTransmitterComponent::configure_rmt_() {
   }
 
   esp_err_t error = rmt_config(&c);
-  if (error != ESP_OK) {
-    this->error_code_ = error;
-    this->mark_failed();
-    return;
+  if (error == ESP_OK) {
+    // we require open-drain mode
+    GPIO.pin[c.gpio_num].pad_driver = 1;
   }
+  return error;
+}
 
-  if (!this->initialized_) {
-    error = rmt_driver_install(this->channel_, 0, 0);
-    if (error != ESP_OK) {
-      this->error_code_ = error;
-      this->mark_failed();
-      return;
-    }
-    this->initialized_ = true;
-  }
+void RemoteTransmitterComponent::route_pin_(rmt_channel_t channel) {
+  const auto gpio_num = gpio_num_t(this->pin_->get_pin());
+  rmt_set_gpio(channel, RMT_MODE_TX, gpio_num, false);
   // we require open-drain mode
-  GPIO.pin[c.gpio_num].pad_driver = 1;
+  GPIO.pin[gpio_num].pad_driver = 1;
+  this->active_channel_ = channel;
+}
+
+remote_base::RemoteRMTChannel *RemoteTransmitterComponent::channel_for_(uint32_t carrier_frequency) {
+  for (auto &carrier_channel : this->carrier_channels_) {
+    if (carrier_channel.carrier_frequency == carrier_frequency)
+      return carrier_channel.channel;
+  }
+  return this;
+}
+
+void RemoteTransmitterComponent::add_carrier_channel(uint32_t carrier_frequency) {
+  this->carrier_channels_.push_back({new remote_base::RemoteRMTChannel(), carrier_frequency, false});  // NOLINT
 }
 
 void RemoteTransmitterComponent::set_rmt_force_inverted(bool state) {
+  this->wait_tx_done_();
   bool loop_en;
   esp_err_t error = rmt_get_tx_loop_mode(this->channel_, &loop_en);
   if (error != ESP_OK) {
@@ -95,39 +224,16 @@ void RemoteTransmitterComponent::set_rmt_force_inverted(bool state) {
 
   this->force_inverted_ = state;
   this->configure_rmt_();
+  this->configure_carrier_channels_();
 }
 
-void RemoteTransmitterComponent::send_internal(uint32_t send_times, uint32_t send_wait) {
-  if (this->is_failed())
-    return;
-
-  bool loop_requested = send_times == 0;
-  bool loop_en;
-  esp_err_t error = rmt_get_tx_loop_mode(this->channel_, &loop_en);
-  if (error != ESP_OK) {
-    ESP_LOGW(TAG, "rmt_get_tx_loop_mode failed: %s", esp_err_to_name(error));
-    this->status_set_warning();
-  } else {
-    this->status_clear_warning();
-  }
-
-  if (this->current_carrier_frequency_ != this->temp_.get_carrier_frequency()) {
-    this->current_carrier_frequency_ = this->temp_.get_carrier_frequency();
-    if (loop_en) {
-      rmt_set_tx_loop_mode(this->channel_, false);
-      rmt_set_tx_intr_en(this->channel_, true);
-      loop_en = false;  // do not try to disable these again (below)
-      rmt_wait_tx_done(this->channel_, RMT_WAIT_TX_DONE_TIMEOUT);
-    }
-    this->configure_rmt_();
-  }
-
+void RemoteTransmitterComponent::encode_rmt_items_(uint32_t send_times, uint32_t send_wait) {
   this->rmt_temp_.clear();
-  this->rmt_temp_.reserve((this->temp_.get_data().size() + 1) / 2);
+  this->rmt_temp_.reserve(send_times * (this->temp_.get_rmt_item_count() + 1));
   uint32_t rmt_i = 0;
   rmt_item32_t rmt_item;
 
-  for (int32_t val : this->temp_.get_data()) {
+  const auto add = [this, &rmt_i, &rmt_item](int32_t val) {
     bool level = val >= 0;
     if (!level)
       val = -val;
@@ -147,6 +253,13 @@ void RemoteTransmitterComponent::send_internal(uint32_t send_times, uint32_t sen
       }
       rmt_i++;
     } while (val != 0);
+  };
+  // repeats are sent in one go, with the wait between them as a space
+  for (uint32_t i = 0; i < send_times; i++) {
+    if (i != 0 && send_wait != 0)
+      add(-int32_t(send_wait));
+    for (int32_t val : this->temp_.get_data())
+      add(val);
   }
 
   if (rmt_i % 2 == 1) {
@@ -154,36 +267,108 @@ void RemoteTransmitterComponent::send_internal(uint32_t send_times, uint32_t sen
     rmt_item.duration1 = 0;
     this->rmt_temp_.push_back(rmt_item);
   }
+}
 
-  if ((this->rmt_temp_.data() == nullptr) || this->rmt_temp_.empty()) {
-    ESP_LOGE(TAG, "Empty data");
+void RemoteTransmitterComponent::wait_tx_done_() {
+  if (!this->tx_pending_)
     return;
+  rmt_wait_tx_done(this->active_channel_, portMAX_DELAY);
+  this->tx_pending_ = false;
+}
+
+bool RemoteTransmitterComponent::is_transmitting_() {
+  if (this->tx_pending_ && rmt_wait_tx_done(this->active_channel_, 0) == ESP_OK)
+    this->tx_pending_ = false;
+  return this->tx_pending_;
+}
+
+void RemoteTransmitterComponent::send_internal(uint32_t send_times, uint32_t send_wait) {
+  if (this->is_failed())
+    return;
+  this->wait_tx_done_();
+
+  bool loop_requested = send_times == 0;
+  remote_base::RemoteRMTChannel *target = this->channel_for_(this->temp_.get_carrier_frequency());
+  const rmt_channel_t channel = target->get_channel();
+  // a looped frame has to fit the channel's memory, the driver can't refill it
+  const uint32_t rmt_capacity = target->get_mem_block_num() * SOC_RMT_MEM_WORDS_PER_CHANNEL;
+  if (loop_requested && this->temp_.get_rmt_item_count() > rmt_capacity) {
+    ESP_LOGE(TAG, "Frame needs %" PRIu32 " RMT items, only %" PRIu32 " fit for looping",
+             this->temp_.get_rmt_item_count(), rmt_capacity);
+    return;
+  }
+  bool loop_en;
+  esp_err_t error = rmt_get_tx_loop_mode(this->active_channel_, &loop_en);
+  if (error != ESP_OK) {
+    ESP_LOGW(TAG, "rmt_get_tx_loop_mode failed: %s", esp_err_to_name(error));
+    this->status_set_warning();
+  } else {
+    this->status_clear_warning();
   }
 
-  if (loop_en) {
-    rmt_set_tx_loop_mode(this->channel_, false);
-    rmt_set_tx_intr_en(this->channel_, true);
-    rmt_wait_tx_done(this->channel_, RMT_WAIT_TX_DONE_TIMEOUT);
+  if (channel != this->active_channel_) {
+    if (loop_en) {
+      rmt_set_tx_loop_mode(this->active_channel_, false);
+      rmt_set_tx_intr_en(this->active_channel_, true);
+      loop_en = false;  // do not try to disable these again (below)
+      rmt_wait_tx_done(this->active_channel_, RMT_WAIT_TX_DONE_TIMEOUT);
+    }
+    this->route_pin_(channel);
+  }
+
+  if (channel == this->channel_ && this->current_carrier_frequency_ != this->temp_.get_carrier_frequency()) {
+    this->current_carrier_frequency_ = this->temp_.get_carrier_frequency();
+    if (loop_en) {
+      rmt_set_tx_loop_mode(this->channel_, false);
+      rmt_set_tx_intr_en(this->channel_, true);
+      loop_en = false;  // do not try to disable these again (below)
+      rmt_wait_tx_done(this->channel_, RMT_WAIT_TX_DONE_TIMEOUT);
+    }
+    this->configure_rmt_();
   }
 
   if (loop_requested) {
     send_times = 1;
   }
 
-  for (uint32_t i = 0; i < send_times; i++) {
-    esp_err_t error = rmt_write_items(this->channel_, this->rmt_temp_.data(), this->rmt_temp_.size(), !loop_requested);
-    if (error != ESP_OK) {
-      ESP_LOGW(TAG, "rmt_write_items failed: %s", esp_err_to_name(error));
-      this->status_set_warning();
-    } else {
-      this->status_clear_warning();
-    }
-    if (i + 1 < send_times)
-      delayMicroseconds(send_wait);
+  const bool streaming = this->streaming_ && !loop_requested;
+  if (!streaming)
+    this->encode_rmt_items_(send_times, send_wait);
+
+  if (streaming ? this->temp_.get_data().empty() : this->rmt_temp_.empty()) {
+    ESP_LOGE(TAG, "Empty data");
+    return;
+  }
+
+  if (loop_en) {
+    rmt_set_tx_loop_mode(channel, false);
+    rmt_set_tx_intr_en(channel, true);
+    rmt_wait_tx_done(channel, RMT_WAIT_TX_DONE_TIMEOUT);
+  }
+
+  if (streaming) {
+    // the translator reads from temp_, which may change as soon as we return; wait for it to finish
+    const auto &data = this->temp_.get_data();
+    this->stream_index_ = 0;
+    this->stream_emitted_ = 0;
+    this->stream_repeats_ = send_times - 1;
+    this->stream_wait_ = send_wait;
+    error = rmt_write_sample(channel, reinterpret_cast<const uint8_t *>(data.data()), data.size() * sizeof(int32_t),
+                             true);
+  } else {
+    // rmt_temp_ is left alone until the next send, which waits for this one to finish first
+    error = rmt_write_items(channel, this->rmt_temp_.data(), this->rmt_temp_.size(), false);
+    this->tx_pending_ = !loop_requested && error == ESP_OK;
+  }
+  if (error != ESP_OK) {
+    ESP_LOGW(TAG, "Writing RMT items failed: %s", esp_err_to_name(error));
+    this->status_set_warning();
+  } else {
+    this->status_clear_warning();
   }
   if (loop_requested) {
-    rmt_set_tx_intr_en(this->channel_, false);
-    rmt_set_tx_loop_mode(this->channel_, loop_requested);
+    rmt_set_tx_intr_en(channel, false);
+    rmt_set_tx_loop_mode(channel, loop_requested);
   }
 }
 
@@ -4,6 +4,8 @@
 
 #ifdef USE_ESP8266
 
+#include <esp8266_peri.h>
+
 namespace esphome {
 namespace remote_transmitter {
 
@@ -12,6 +14,14 @@ static const char *const TAG = "remote_transmitter";
 void RemoteTransmitterComponent::setup() {
   this->pin_->setup();
   this->pin_->digital_write(false);
+  this->isr_pin_ = this->pin_->to_isr();
+  const uint8_t pin = this->pin_->get_pin();
+  if (pin < 16) {
+    const bool inverted = this->pin_->is_inverted();
+    this->pin_set_reg_ = inverted ? &GPOC : &GPOS;
+    this->pin_clear_reg_ = inverted ? &GPOS : &GPOC;
+    this->pin_mask_ = 1UL << pin;
+  }
 }
 
 void RemoteTransmitterComponent::dump_config() {
@@ -42,53 +52,14 @@ void RemoteTransmitterComponent::await_target_time_() {
   }
 }
 
-void RemoteTransmitterComponent::mark_(uint32_t on_time, uint32_t off_time, uint32_t usec) {
-  this->await_target_time_();
-  this->pin_->digital_write(true);
-
-  const uint32_t target = this->target_time_ + usec;
-  if (this->carrier_duty_percent_ < 100 && (on_time > 0 || off_time > 0)) {
-    while (true) {  // Modulate with carrier frequency
-      this->target_time_ += on_time;
-      if (this->target_time_ >= target)
-        break;
-      this->await_target_time_();
-      this->pin_->digital_write(false);
-
-      this->target_time_ += off_time;
-      if (this->target_time_ >= target)
-        break;
-      this->await_target_time_();
-      this->pin_->digital_write(true);
-    }
-  }
-  this->target_time_ = target;
-}
-
-void RemoteTransmitterComponent::space_(uint32_t usec) {
-  this->await_target_time_();
-  this->pin_->digital_write(false);
-  this->target_time_ += usec;
-}
-
 void RemoteTransmitterComponent::send_internal(uint32_t send_times, uint32_t send_wait) {
   ESP_LOGD(TAG, "Sending remote code...");
   uint32_t on_time, off_time;
   this->calculate_on_off_time_(this->temp_.get_carrier_frequency(), &on_time, &off_time);
   this->target_time_ = 0;
   for (uint32_t i = 0; i < send_times; i++) {
-    for (int32_t item : this->temp_.get_data()) {
-      if (item > 0) {
-        const auto length = uint32_t(item);
-        this->mark_(on_time, off_time, length);
-      } else {
-        const auto length = uint32_t(-item);
-        this->space_(length);
-      }
-      App.feed_wdt();
-    }
-    this->await_target_time_();  // wait for duration of last pulse
-    this->pin_->digital_write(false);
+    this->transmit_frame_(on_time, off_time);
+    App.feed_wdt();
 
     if (i + 1 < send_times)
       this->target_time_ += send_wait;
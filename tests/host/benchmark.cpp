@@ -0,0 +1,30 @@
+// Decoder throughput on the host: every protocol decodes a sample frame of every protocol plus random noise, the
+// same run remote_base.benchmark does on a device.
+//
+//   build/benchmark [iterations [noise frames]]
+#include "host.h"
+#include "corpus.h"
+#include "esphome/core/log.h"
+
+#include <cstdlib>
+
+using namespace esphome::remote_base;
+
+int main(int argc, char **argv) {
+  const uint32_t iterations = argc > 1 ? strtoul(argv[1], nullptr, 10) : 1000;
+  const uint32_t noise_frames = argc > 2 ? strtoul(argv[2], nullptr, 10) : 20;
+  host::set_log_level(ESPHOME_LOG_LEVEL_INFO);
+
+  RemoteBenchmark benchmark;
+  std::vector<RawTimings> frames;
+  for (const auto &sample : host::samples()) {
+    sample.add_decoder(&benchmark, sample.name);
+    frames.push_back(sample.timings());
+  }
+  for (const auto &frame : frames)
+    benchmark.add_frame(frame.data(), frame.size());
+  benchmark.set_noise_frames(noise_frames);
+  benchmark.set_iterations(iterations);
+  benchmark.run();
+  return 0;
+}
@@ -0,0 +1,36 @@
+// Estimate the carrier frequency of a capture taken without demodulator, so learned codes replay at the right one.
+//
+// Reads signed timings in µs (marks positive, spaces negative) separated by commas or whitespace from stdin, the
+// way raw dumps and remote_capture_reader.py print them, and prints the carrier and the frame with each carrier
+// burst collapsed into a single mark.
+#include "host.h"
+#include "esphome/components/remote_base/remote_base.h"
+
+#include <cinttypes>
+#include <cstdio>
+
+using namespace esphome::remote_base;
+
+int main() {
+  RawTimings data;
+  int c;
+  while ((c = getchar()) != EOF) {
+    if (c == '-' || (c >= '0' && c <= '9')) {
+      ungetc(c, stdin);
+      int32_t value;
+      if (scanf("%" SCNd32, &value) == 1)
+        data.push_back(value);
+    }
+  }
+  const uint32_t carrier_frequency = estimate_carrier_frequency(data);
+  if (carrier_frequency == 0) {
+    printf("No carrier found in %zu timings; the capture is likely demodulated already\n", data.size());
+    return 1;
+  }
+  collapse_carrier(data, carrier_frequency);
+  printf("carrier_frequency: %" PRIu32 "Hz\ncode: [", carrier_frequency);
+  for (size_t i = 0; i < data.size(); i++)
+    printf(i == 0 ? "%" PRId32 : ", %" PRId32, data[i]);
+  printf("]\n");
+  return 0;
+}
@@ -0,0 +1,119 @@
+#pragma once
+// A sample frame of every protocol remote_base decodes, encoded by the protocol itself
+#include "esphome/components/remote_base/aeha_protocol.h"
+#include "esphome/components/remote_base/canalsat_protocol.h"
+#include "esphome/components/remote_base/coolix_protocol.h"
+#include "esphome/components/remote_base/dish_protocol.h"
+#include "esphome/components/remote_base/drayton_protocol.h"
+#include "esphome/components/remote_base/haier_protocol.h"
+#include "esphome/components/remote_base/honeywell_string_lights_protocol.h"
+#include "esphome/components/remote_base/jvc_protocol.h"
+#include "esphome/components/remote_base/lg_protocol.h"
+#include "esphome/components/remote_base/magiquest_protocol.h"
+#include "esphome/components/remote_base/midea_protocol.h"
+#include "esphome/components/remote_base/nec_protocol.h"
+#include "esphome/components/remote_base/nexa_protocol.h"
+#include "esphome/components/remote_base/panasonic_protocol.h"
+#include "esphome/components/remote_base/pioneer_protocol.h"
+#include "esphome/components/remote_base/pronto_protocol.h"
+#include "esphome/components/remote_base/rc5_protocol.h"
+#include "esphome/components/remote_base/rc6_protocol.h"
+#include "esphome/components/remote_base/remote_benchmark.h"
+#include "esphome/components/remote_base/samsung36_protocol.h"
+#include "esphome/components/remote_base/samsung_protocol.h"
+#include "esphome/components/remote_base/sony_protocol.h"
+#include "esphome/components/remote_base/toshiba_ac_protocol.h"
+
+#include <functional>
+#include <vector>
+
+namespace host {
+
+struct Sample {
+  const char *name;
+  std::function<void(esphome::remote_base::RemoteTransmitData *dst)> encode;
+  /// Whether src decodes to the data the sample was encoded from
+  std::function<bool(esphome::remote_base::RemoteReceiveData src)> decodes;
+  void (*add_decoder)(esphome::remote_base::RemoteBenchmark *benchmark, const char *name);
+  esphome::remote_base::RemoteRoundTrip::CheckFunction round_trips;
+  /// The decoded data holds the received timings, so it only matches the encoded data within tolerance
+  bool lossy;
+  /// The decoder reads the signal of an inverted receiver pin
+  bool inverted;
+
+  /// The frame as a receiver captures it
+  esphome::remote_base::RawTimings timings() const {
+    esphome::remote_base::RemoteTransmitData data;
+    this->encode(&data);
+    esphome::remote_base::RawTimings timings = data.get_data();
+    esphome::remote_base::RemoteRoundTrip::capture(&timings, this->inverted);
+    return timings;
+  }
+};
+
+template<typename T, typename D> Sample sample(const char *name, const D &data, bool inverted = false) {
+  using namespace esphome::remote_base;
+  return {name,
+          [data](RemoteTransmitData *dst) { T().encode(dst, data); },
+          [data](RemoteReceiveData src) {
+            auto decoded = T().decode(src);
+            return decoded.has_value() && *decoded == data;
+          },
+          [](RemoteBenchmark *benchmark, const char *name) { benchmark->add_protocol<T>(name); },
+          &RemoteRoundTrip::round_trips<T>,
+          false,
+          inverted};
+}
+
+template<typename T, typename D> Sample lossy_sample(const char *name, const D &data) {
+  Sample sample = host::sample<T>(name, data);
+  sample.round_trips = &esphome::remote_base::RemoteRoundTrip::round_trips_within<T>;
+  sample.lossy = true;
+  return sample;
+}
+
+inline std::vector<Sample> samples() {
+  using namespace esphome::remote_base;
+  MideaData midea{0xA1, 0x82, 0x48, 0xFF, 0xFF};
+  midea.finalize();
+  CanalSatData canalsat{};
+  canalsat.device = 0x1B;
+  canalsat.address = 0x05;
+  canalsat.command = 0x2A;
+  CanalSatLDData canalsat_ld{};
+  canalsat_ld.device = 0x1B;
+  canalsat_ld.address = 0x05;
+  canalsat_ld.command = 0x2A;
+  RC6Data rc6{};
+  rc6.address = 0x04;
+  rc6.command = 0x0C;
+  return {
+      sample<AEHAProtocol>("aeha", AEHAData{0x2002, {0x80, 0x00, 0x00, 0x06, 0x60}}),
+      sample<CanalSatProtocol>("canalsat", canalsat),
+      sample<CanalSatLDProtocol>("canalsat_ld", canalsat_ld),
+      sample<CoolixProtocol>("coolix", CoolixData(0xB2BF20, 0xB2BF20)),
+      sample<DishProtocol>("dish", DishData{1, 0x12}),
+      sample<DraytonProtocol>("drayton", DraytonData{0x1234, 0x05, 0x0A}),
+      sample<HaierProtocol>("haier", HaierData{{0xA6, 0x12, 0x00, 0x00, 0x40, 0x20, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+                                                0x05}}),
+      sample<HSLProtocol>("honeywell_string_lights", HSLData{0x1234}, true),
+      sample<JVCProtocol>("jvc", JVCData{0xC5E8}),
+      sample<LGProtocol>("lg", LGData{0x88C0051, 28}),
+      sample<MagiQuestProtocol>("magiquest", MagiQuestData{0x00AB, 0x12345678}),
+      sample<MideaProtocol>("midea", midea),
+      sample<NECProtocol>("nec", NECData{0x1234, 0x5678}),
+      sample<NexaProtocol>("nexa", NexaData{0x1234567, 0, 1, 3, 0}),
+      sample<PanasonicProtocol>("panasonic", PanasonicData{0x4004, 0x0100BCBD}),
+      sample<PioneerProtocol>("pioneer", PioneerData{0xA55A, 0}),
+      lossy_sample<ProntoProtocol>("pronto",
+                                   ProntoData{"0000 006D 0004 0000 0155 00AA 0015 0015 0015 0040 0015 0181"}),
+      sample<RC5Protocol>("rc5", RC5Data{0x05, 0x23}),
+      sample<RC6Protocol>("rc6", rc6),
+      sample<Samsung36Protocol>("samsung36", Samsung36Data{0x0400, 0x000E00FF}),
+      sample<SamsungProtocol>("samsung", SamsungData{0xE0E040BF, 32}),
+      sample<SonyProtocol>("sony", SonyData{0xA90, 12}),
+      sample<ToshibaAcProtocol>("toshiba_ac", ToshibaAcData{0xB24DBF4040BF, 0}),
+  };
+}
+
+}  // namespace host
@@ -0,0 +1,27 @@
+#pragma once
+// An output pin whose writes are recorded as pin edges
+#include "host.h"
+#include "esphome/core/hal.h"
+
+namespace host {
+
+class FakePin : public esphome::InternalGPIOPin {
+ public:
+  explicit FakePin(uint8_t pin = 4, uint32_t write_cost = 0) : pin_(pin), write_cost_(write_cost) {}
+  void setup() override {}
+  bool digital_read() override { return false; }
+  /// Written through the virtual interface, which costs write_cost µs more than an ISR pin write
+  void digital_write(bool value) override {
+    advance_micros(this->write_cost_);
+    esphome::ISRInternalGPIOPin().digital_write(value);
+  }
+  uint8_t get_pin() const override { return this->pin_; }
+  bool is_inverted() const override { return false; }
+  esphome::ISRInternalGPIOPin to_isr() const override { return {}; }
+
+ protected:
+  uint8_t pin_;
+  uint32_t write_cost_;
+};
+
+}  // namespace host
@@ -0,0 +1,33 @@
+#pragma once
+// A receiver without hardware: frames are handed to it with receive() and go through the same pipeline as received
+// ones (carrier detection, glitch merging, noise filter, segmentation, fingerprint cache, listeners and dumpers).
+#include "esphome/components/remote_base/remote_base.h"
+
+namespace host {
+
+class FakeReceiver : public esphome::remote_base::RemoteReceiverBase {
+ public:
+  FakeReceiver(uint8_t tolerance = 25) : RemoteReceiverBase(nullptr) { this->tolerance_ = tolerance; }
+  void receive(const esphome::remote_base::RawTimings &timings) {
+    this->temp_ = timings;
+    this->call_listeners_dumpers_();
+  }
+};
+
+/// Counts the decodes and dumps of protocol T
+template<typename T, typename D> class CountingProtocol : public esphome::remote_base::RemoteProtocol<D> {
+ public:
+  void encode(esphome::remote_base::RemoteTransmitData *dst, const D &data) override { T().encode(dst, data); }
+  esphome::optional<D> decode(esphome::remote_base::RemoteReceiveData src) override {
+    decodes++;
+    return T().decode(src);
+  }
+  void dump(const D &data) override { dumps++; }
+
+  static uint32_t decodes;
+  static uint32_t dumps;
+};
+template<typename T, typename D> uint32_t CountingProtocol<T, D>::decodes = 0;
+template<typename T, typename D> uint32_t CountingProtocol<T, D>::dumps = 0;
+
+}  // namespace host
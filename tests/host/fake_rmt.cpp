@@ -0,0 +1,104 @@
+// Stand-in for the ESP-IDF RMT driver: items are recorded instead of sent, and rmt_write_sample() calls the
+// translator the way the driver's refill interrupt does, one memory block first and half a block per refill after.
+#include "host.h"
+
+#include <soc/gpio_periph.h>
+
+#include <algorithm>
+
+gpio_dev_t GPIO;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+namespace host {
+
+static FakeRMTChannel channels[RMT_CHANNEL_MAX];
+static rmt_channel_t translating_channel = RMT_CHANNEL_0;
+
+FakeRMTChannel &rmt_channel(rmt_channel_t channel) { return channels[channel]; }
+
+void reset_rmt() {
+  for (auto &channel : channels)
+    channel = FakeRMTChannel{};
+}
+
+void finish_rmt(rmt_channel_t channel) { channels[channel].busy = false; }
+
+}  // namespace host
+
+const char *esp_err_to_name(esp_err_t code) { return code == ESP_OK ? "ESP_OK" : "ESP_FAIL"; }
+
+esp_err_t rmt_config(const rmt_config_t *rmt_param) {
+  auto &channel = host::rmt_channel(rmt_param->channel);
+  channel.mem_block_num = rmt_param->mem_block_num;
+  channel.loop = rmt_param->tx_config.loop_en;
+  return ESP_OK;
+}
+esp_err_t rmt_driver_install(rmt_channel_t channel, size_t rx_buf_size, int intr_alloc_flags) { return ESP_OK; }
+esp_err_t rmt_get_tx_loop_mode(rmt_channel_t channel, bool *loop_en) {
+  *loop_en = host::rmt_channel(channel).loop;
+  return ESP_OK;
+}
+esp_err_t rmt_set_tx_loop_mode(rmt_channel_t channel, bool loop_en) {
+  host::rmt_channel(channel).loop = loop_en;
+  return ESP_OK;
+}
+esp_err_t rmt_set_tx_loop_count(rmt_channel_t channel, uint32_t count) { return ESP_OK; }
+esp_err_t rmt_enable_tx_loop_autostop(rmt_channel_t channel, bool en) { return ESP_OK; }
+esp_err_t rmt_set_tx_intr_en(rmt_channel_t channel, bool en) { return ESP_OK; }
+esp_err_t rmt_set_gpio(rmt_channel_t channel, rmt_mode_t mode, gpio_num_t gpio_num, bool invert_signal) {
+  return ESP_OK;
+}
+esp_err_t rmt_tx_stop(rmt_channel_t channel) {
+  host::finish_rmt(channel);
+  return ESP_OK;
+}
+
+esp_err_t rmt_wait_tx_done(rmt_channel_t channel, uint32_t wait_time) {
+  auto &fake = host::rmt_channel(channel);
+  if (fake.busy && wait_time == 0)
+    return ESP_ERR_TIMEOUT;
+  fake.busy = false;
+  return ESP_OK;
+}
+
+esp_err_t rmt_write_items(rmt_channel_t channel, const rmt_item32_t *rmt_item, int item_num, bool wait_tx_done) {
+  auto &fake = host::rmt_channel(channel);
+  fake.items.insert(fake.items.end(), rmt_item, rmt_item + item_num);
+  fake.busy = !wait_tx_done;
+  return ESP_OK;
+}
+
+esp_err_t rmt_translator_init(rmt_channel_t channel, sample_to_rmt_t fn) {
+  host::rmt_channel(channel).translator = fn;
+  return ESP_OK;
+}
+esp_err_t rmt_translator_set_context(rmt_channel_t channel, void *context) {
+  host::rmt_channel(channel).context = context;
+  return ESP_OK;
+}
+esp_err_t rmt_translator_get_context(const size_t *item_num, void **context) {
+  *context = host::rmt_channel(host::translating_channel).context;
+  return ESP_OK;
+}
+
+esp_err_t rmt_write_sample(rmt_channel_t channel, const uint8_t *src, size_t src_size, bool wait_tx_done) {
+  auto &fake = host::rmt_channel(channel);
+  if (fake.translator == nullptr)
+    return ESP_FAIL;
+  host::translating_channel = channel;
+  const size_t block = fake.mem_block_num * SOC_RMT_MEM_WORDS_PER_CHANNEL;
+  std::vector<rmt_item32_t> buffer(block);
+  size_t wanted = block;
+  while (src_size > 0) {
+    size_t translated = 0, items = 0;
+    fake.translator(src, buffer.data(), src_size, wanted, &translated, &items);
+    if (items > wanted || (translated == 0 && items == 0))
+      return ESP_FAIL;  // overran the memory block, or made no progress
+    fake.items.insert(fake.items.end(), buffer.begin(), buffer.begin() + items);
+    fake.refills.push_back(items);
+    src += translated;
+    src_size -= translated;
+    wanted = block / 2;
+  }
+  fake.busy = !wait_tx_done;
+  return ESP_OK;
+}
@@ -0,0 +1,39 @@
+#pragma once
+// A transmitter without hardware that records what it sends. Like the ESP32 one it can send in the background: a
+// frame is then on air for its duration on the (simulated) clock, and loop() sends queued frames once it's done.
+#include "host.h"
+#include "esphome/components/remote_base/remote_base.h"
+
+namespace host {
+
+class FakeTransmitter : public esphome::remote_base::RemoteTransmitterBase, public esphome::Component {
+ public:
+  struct Sent {
+    uint32_t time;
+    uint32_t send_times;
+    uint32_t send_wait;
+    esphome::remote_base::RawTimings data;
+  };
+
+  explicit FakeTransmitter(bool background = true) : RemoteTransmitterBase(nullptr), background_(background) {}
+  void loop() override { this->send_pending_(); }
+
+  std::vector<Sent> sent;
+
+ protected:
+  void send_internal(uint32_t send_times, uint32_t send_wait) override {
+    this->sent.push_back({now_micros(), send_times, send_wait, this->temp_.get_data()});
+    const uint32_t duration = send_times * this->temp_.get_duration() + (send_times - 1) * send_wait;
+    if (this->background_) {
+      this->busy_until_ = now_micros() + duration;
+    } else {
+      advance_micros(duration);
+    }
+  }
+  bool is_transmitting_() override { return int32_t(this->busy_until_ - now_micros()) > 0; }
+
+  bool background_;
+  uint32_t busy_until_{0};
+};
+
+}  // namespace host
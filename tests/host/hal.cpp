@@ -0,0 +1,169 @@
+#include "host.h"
+#include "esphome/core/application.h"
+#include "esphome/core/component.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <chrono>
+#include <cstdarg>
+#include <list>
+#include <random>
+#include <string>
+
+namespace host {
+
+static bool simulated_clock = false;
+static uint32_t clock_auto_advance = 0;
+static uint64_t simulated_micros = 0;
+static int log_level = ESPHOME_LOG_LEVEL_WARN;
+static int failed_checks = 0;
+static uint32_t pin_write_cost = 0;
+
+struct Timeout {
+  esphome::Component *component;
+  std::string name;
+  uint32_t due;
+  uint32_t interval;
+  std::function<void()> f;
+};
+static std::list<Timeout> timeouts;
+
+void set_simulated_clock(bool simulated, uint32_t auto_advance) {
+  simulated_clock = simulated;
+  clock_auto_advance = auto_advance;
+}
+void advance_micros(uint32_t us) { simulated_micros += us; }
+uint32_t now_micros() { return simulated_micros; }
+void set_log_level(int level) { log_level = level; }
+
+void set_pin_write_cost(uint32_t us) { pin_write_cost = us; }
+
+std::vector<PinEdge> &pin_edges() {
+  static std::vector<PinEdge> edges;
+  return edges;
+}
+
+static bool cancel(esphome::Component *component, const std::string &name) {
+  if (name.empty())
+    return false;
+  const size_t before = timeouts.size();
+  timeouts.remove_if([&](const Timeout &t) { return t.component == component && t.name == name; });
+  return timeouts.size() != before;
+}
+
+static void schedule(esphome::Component *component, const std::string &name, uint32_t delay, uint32_t interval,
+                     std::function<void()> &&f) {
+  cancel(component, name);
+  timeouts.push_back({component, name, esphome::millis() + delay, interval, std::move(f)});
+}
+
+size_t pending_timeouts() { return timeouts.size(); }
+
+void run_scheduler(bool advance, uint32_t limit_ms) {
+  const uint32_t start = esphome::millis();
+  while (!timeouts.empty()) {
+    auto next = timeouts.begin();
+    for (auto it = timeouts.begin(); it != timeouts.end(); ++it) {
+      if (int32_t(it->due - next->due) < 0)
+        next = it;
+    }
+    const int32_t wait = next->due - esphome::millis();
+    if (wait > 0) {
+      if (!advance || !simulated_clock || next->due - start > limit_ms)
+        return;
+      simulated_micros = uint64_t(next->due) * 1000;
+    }
+    auto f = next->f;
+    if (next->interval != 0) {
+      next->due += next->interval;
+    } else {
+      timeouts.erase(next);
+    }
+    f();
+  }
+}
+
+int check(bool ok, const char *expr, const char *file, int line) {
+  if (!ok) {
+    printf("%s:%d: check failed: %s\n", file, line, expr);
+    failed_checks++;
+  }
+  return ok;
+}
+int failures() { return failed_checks; }
+
+}  // namespace host
+
+namespace esphome {
+
+Application App;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+namespace setup_priority {
+const float HARDWARE = 800.0f;
+const float DATA = 600.0f;
+const float IO = 400.0f;
+const float LATE = -100.0f;
+}  // namespace setup_priority
+
+static uint64_t real_micros() {
+  static const auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+uint32_t micros() {
+  if (!host::simulated_clock)
+    return real_micros();
+  host::simulated_micros += host::clock_auto_advance;
+  return host::simulated_micros;
+}
+uint32_t millis() { return (host::simulated_clock ? host::simulated_micros : real_micros()) / 1000; }
+void delay(uint32_t ms) { delayMicroseconds(ms * 1000); }
+void delayMicroseconds(uint32_t us) {
+  if (host::simulated_clock) {
+    host::simulated_micros += us;
+    return;
+  }
+  const uint64_t end = real_micros() + us;
+  while (real_micros() < end) {
+  }
+}
+void yield() {}
+uint32_t arch_get_cpu_freq_hz() { return 1000000; }
+uint32_t arch_get_cpu_cycle_count() { return micros(); }
+
+void ISRInternalGPIOPin::digital_write(bool value) {
+  host::pin_edges().push_back({host::now_micros(), value});
+  host::simulated_micros += host::pin_write_cost;
+}
+
+static std::mt19937 &rng() {
+  static std::mt19937 generator(1);  // fixed seed, so runs are repeatable
+  return generator;
+}
+uint32_t random_uint32() { return rng()(); }
+float random_float() { return std::uniform_real_distribution<float>(0.0f, 1.0f)(rng()); }
+
+void host_log(int level, const char *tag, const char *format, ...) {
+  if (level > host::log_level)
+    return;
+  static const char LEVELS[] = "?EWICDVV";
+  printf("[%c][%s] ", LEVELS[level], tag);
+  va_list args;
+  va_start(args, format);
+  vprintf(format, args);
+  va_end(args);
+  printf("\n");
+}
+
+Component::~Component() { host::timeouts.remove_if([this](const host::Timeout &t) { return t.component == this; }); }
+void Component::set_timeout(const std::string &name, uint32_t timeout, std::function<void()> &&f) {
+  host::schedule(this, name, timeout, 0, std::move(f));
+}
+bool Component::cancel_timeout(const std::string &name) { return host::cancel(this, name); }
+void Component::set_interval(const std::string &name, uint32_t interval, std::function<void()> &&f) {
+  host::schedule(this, name, interval, std::max<uint32_t>(interval, 1), std::move(f));
+}
+bool Component::cancel_interval(const std::string &name) { return host::cancel(this, name); }
+
+}  // namespace esphome
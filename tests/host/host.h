@@ -0,0 +1,60 @@
+#pragma once
+// Host-side test helpers: a controllable clock, the scheduler behind Component timeouts, recorded pin edges and
+// checks. The stub HAL in stubs/ and hal.cpp is just enough to run remote_base and remote_transmitter on a PC.
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#ifdef USE_ESP32
+#include <driver/rmt.h>
+#endif
+
+namespace host {
+
+/// Route micros()/millis() to a simulated clock that only moves when advanced, plus auto_advance microseconds on
+/// every micros() call so busy-wait loops finish; the real monotonic clock is used otherwise.
+void set_simulated_clock(bool simulated, uint32_t auto_advance = 0);
+void advance_micros(uint32_t us);
+/// Current simulated time, without auto advancing
+uint32_t now_micros();
+
+/// Run every timeout that is due; with advance, move the simulated clock to each pending timeout first, until none
+/// are left or limit_ms have passed
+void run_scheduler(bool advance = false, uint32_t limit_ms = 60000);
+size_t pending_timeouts();
+
+void set_log_level(int level);
+
+struct PinEdge {
+  uint32_t time;
+  bool level;
+};
+/// Every ISRInternalGPIOPin::digital_write() with the time it happened
+std::vector<PinEdge> &pin_edges();
+/// Simulated µs each ISRInternalGPIOPin::digital_write() takes, after the edge
+void set_pin_write_cost(uint32_t us);
+
+#ifdef USE_ESP32
+struct FakeRMTChannel {
+  sample_to_rmt_t translator{nullptr};
+  void *context{nullptr};
+  uint8_t mem_block_num{1};
+  bool loop{false};
+  /// A transmission is running until it's waited for or finish_rmt() is called
+  bool busy{false};
+  std::vector<rmt_item32_t> items;
+  /// Number of items the translator produced on each call, the first one filling the whole memory block
+  std::vector<size_t> refills;
+};
+FakeRMTChannel &rmt_channel(rmt_channel_t channel);
+void reset_rmt();
+void finish_rmt(rmt_channel_t channel);
+#endif
+
+int check(bool ok, const char *expr, const char *file, int line);
+/// Number of failed checks; a test's main() returns it
+int failures();
+
+}  // namespace host
+
+#define CHECK(expr) host::check(static_cast<bool>(expr), #expr, __FILE__, __LINE__)
@@ -0,0 +1,42 @@
+# Writes the cases of test_static_encoding to stdout: frames encoded by the codegen-time
+# encoders of components/remote_base/encoding.py, each with the C++ encode() call that
+# has to give the same timings.
+import importlib.util
+import os
+import sys
+
+path = os.path.join(
+    os.path.dirname(__file__), "../../components/remote_base/encoding.py"
+)
+spec = importlib.util.spec_from_file_location("encoding", path)
+encoding = importlib.util.module_from_spec(spec)
+spec.loader.exec_module(encoding)
+
+# (encoder, C++ protocol prefix, argument lists)
+CASES = [
+    ("dish", "Dish", [(1, 0x12), (16, 0x3F), (9, 0)]),
+    ("jvc", "JVC", [(0xC5E8,), (0xFFFF,)]),
+    ("lg", "LG", [(0x88C0051, 28), (0xFFFFFFFF, 32)]),
+    ("nec", "NEC", [(0x1234, 0x5678), (0xFF00, 0x00FF)]),
+    ("panasonic", "Panasonic", [(0x4004, 0x0100BCBD)]),
+    ("pioneer", "Pioneer", [(0xA55A, 0), (0xA556, 0xA506)]),
+    ("samsung", "Samsung", [(0xE0E040BF, 32), (0x123456789ABCDEF0, 64)]),
+    ("samsung36", "Samsung36", [(0x0400, 0x000E00FF)]),
+    ("sony", "Sony", [(0xA90, 12), (0x1234, 15), (0xABCDE, 20)]),
+    (
+        "toshiba_ac",
+        "ToshibaAc",
+        [(0xB24DBF4040BF, 0), (0xB24DBF4040BF, 0xD5660001003C)],
+    ),
+]
+
+out = sys.stdout
+out.write("// Generated by static_encodings.py\n")
+for name, prefix, arguments in CASES:
+    for args in arguments:
+        carrier_frequency, timings = getattr(encoding, name)(*args)
+        data = ", ".join(hex(arg) for arg in args)
+        encode = f"{prefix}Protocol().encode(dst, {prefix}Data{{{data}}});"
+        timings = ", ".join(str(timing) for timing in timings)
+        out.write(f'{{"{name}({data})", [](RemoteTransmitData *dst) {{ {encode} }}, ')
+        out.write(f"{carrier_frequency}, {{{timings}}}}},\n")
@@ -0,0 +1,20 @@
+#pragma once
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace binary_sensor {
+
+class BinarySensor {
+ public:
+  void publish_state(bool state) {
+    this->state = state;
+    this->publishes++;
+  }
+  bool state{false};
+  uint32_t publishes{0};
+};
+
+class BinarySensorInitiallyOff : public BinarySensor {};
+
+}  // namespace binary_sensor
+}  // namespace esphome
@@ -0,0 +1,13 @@
+#pragma once
+#include "component.h"
+
+namespace esphome {
+
+class Application {
+ public:
+  void feed_wdt() {}
+};
+
+extern Application App;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace esphome
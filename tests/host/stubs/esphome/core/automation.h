@@ -0,0 +1,76 @@
+#pragma once
+#include <functional>
+#include <type_traits>
+#include <vector>
+#include "component.h"
+
+namespace esphome {
+
+template<typename T, typename... X> class TemplatableValue {
+ public:
+  TemplatableValue() : type_(NONE) {}
+  template<typename F, typename std::enable_if<!std::is_invocable<F, X...>::value, int>::type = 0>
+  TemplatableValue(F value) : type_(VALUE), value_(value) {}
+  template<typename F, typename std::enable_if<std::is_invocable<F, X...>::value, int>::type = 0>
+  TemplatableValue(F f) : type_(LAMBDA), f_(f) {}
+
+  bool has_value() { return this->type_ != NONE; }
+  T value(X... x) { return this->type_ == LAMBDA ? this->f_(x...) : this->value_; }
+  optional<T> optional_value(X... x) {
+    if (!this->has_value())
+      return {};
+    return this->value(x...);
+  }
+  T value_or(X... x, T default_value) { return this->has_value() ? this->value(x...) : default_value; }
+
+ protected:
+  enum { NONE, VALUE, LAMBDA } type_;
+  T value_{};
+  std::function<T(X...)> f_;
+};
+
+#define TEMPLATABLE_VALUE_(type, name) \
+ protected: \
+  TemplatableValue<type, Ts...> name##_{}; \
+\
+ public: \
+  template<typename V> void set_##name(V name) { this->name##_ = name; }
+#define TEMPLATABLE_VALUE(type, name) TEMPLATABLE_VALUE_(type, name)
+
+/// Calls every callback added with add_callback(), the way automations attach to a trigger
+template<typename... Ts> class Trigger {
+ public:
+  void trigger(Ts... x) {
+    for (auto &callback : this->callbacks_)
+      callback(x...);
+  }
+  void add_callback(std::function<void(Ts...)> &&callback) { this->callbacks_.push_back(std::move(callback)); }
+
+ protected:
+  std::vector<std::function<void(Ts...)>> callbacks_;
+};
+
+template<typename... Ts> class Action {
+ public:
+  virtual ~Action() = default;
+  virtual void play_complex(Ts... x) {
+    this->num_running_++;
+    this->play(x...);
+    this->play_next_(x...);
+  }
+  virtual void stop_complex() {
+    if (this->num_running_ > 0) {
+      this->stop();
+      this->num_running_ = 0;
+    }
+  }
+  bool is_running() { return this->num_running_ > 0; }
+
+ protected:
+  virtual void play(Ts... x) = 0;
+  virtual void stop() {}
+  void play_next_(Ts... x) { this->num_running_--; }
+  int num_running_{0};
+};
+
+}  // namespace esphome
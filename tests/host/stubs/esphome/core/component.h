@@ -0,0 +1,57 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+#include "hal.h"
+#include "helpers.h"
+#include "optional.h"
+
+namespace esphome {
+
+namespace setup_priority {
+extern const float HARDWARE;
+extern const float DATA;
+extern const float IO;
+extern const float LATE;
+}  // namespace setup_priority
+
+/// Timeouts and intervals are kept by the host scheduler and run from host::run_scheduler()
+class Component {
+ public:
+  virtual ~Component();
+  virtual void setup() {}
+  virtual void loop() {}
+  virtual void dump_config() {}
+  virtual float get_setup_priority() const { return setup_priority::DATA; }
+  bool is_failed() const { return this->failed_; }
+  void mark_failed() { this->failed_ = true; }
+  void status_set_warning() {}
+  void status_clear_warning() {}
+  void enable_loop() {}
+  void disable_loop() {}
+
+ protected:
+  void set_timeout(const std::string &name, uint32_t timeout, std::function<void()> &&f);
+  void set_timeout(uint32_t timeout, std::function<void()> &&f) { this->set_timeout("", timeout, std::move(f)); }
+  bool cancel_timeout(const std::string &name);
+  void set_interval(const std::string &name, uint32_t interval, std::function<void()> &&f);
+  void set_interval(uint32_t interval, std::function<void()> &&f) { this->set_interval("", interval, std::move(f)); }
+  bool cancel_interval(const std::string &name);
+  void defer(std::function<void()> &&f) { this->set_timeout("", 0, std::move(f)); }
+  void defer(const std::string &name, std::function<void()> &&f) { this->set_timeout(name, 0, std::move(f)); }
+
+  bool failed_{false};
+};
+
+class PollingComponent : public Component {
+ public:
+  PollingComponent() = default;
+  PollingComponent(uint32_t update_interval) : update_interval_(update_interval) {}
+  virtual void update() = 0;
+  void set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
+
+ protected:
+  uint32_t update_interval_{0};
+};
+
+}  // namespace esphome
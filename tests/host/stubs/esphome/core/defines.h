@@ -0,0 +1,28 @@
+#pragma once
+// Host builds enable every protocol, unless HOST_PROTOCOL_SUBSET is defined along with the wanted ones
+#ifndef HOST_PROTOCOL_SUBSET
+#define USE_REMOTE_PROTOCOL_AEHA
+#define USE_REMOTE_PROTOCOL_CANALSAT
+#define USE_REMOTE_PROTOCOL_COOLIX
+#define USE_REMOTE_PROTOCOL_DISH
+#define USE_REMOTE_PROTOCOL_DRAYTON
+#define USE_REMOTE_PROTOCOL_HAIER
+#define USE_REMOTE_PROTOCOL_HONEYWELL_STRING_LIGHTS
+#define USE_REMOTE_PROTOCOL_JVC
+#define USE_REMOTE_PROTOCOL_LG
+#define USE_REMOTE_PROTOCOL_MAGIQUEST
+#define USE_REMOTE_PROTOCOL_MIDEA
+#define USE_REMOTE_PROTOCOL_NEC
+#define USE_REMOTE_PROTOCOL_NEXA
+#define USE_REMOTE_PROTOCOL_PANASONIC
+#define USE_REMOTE_PROTOCOL_PIONEER
+#define USE_REMOTE_PROTOCOL_PRONTO
+#define USE_REMOTE_PROTOCOL_RAW
+#define USE_REMOTE_PROTOCOL_RC5
+#define USE_REMOTE_PROTOCOL_RC6
+#define USE_REMOTE_PROTOCOL_RC_SWITCH
+#define USE_REMOTE_PROTOCOL_SAMSUNG36
+#define USE_REMOTE_PROTOCOL_SAMSUNG
+#define USE_REMOTE_PROTOCOL_SONY
+#define USE_REMOTE_PROTOCOL_TOSHIBA_AC
+#endif
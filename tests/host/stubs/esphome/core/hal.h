@@ -0,0 +1,46 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+#define IRAM_ATTR
+#define ESPHOME_ALWAYS_INLINE __attribute__((always_inline))
+
+namespace esphome {
+
+uint32_t micros();
+uint32_t millis();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+uint32_t arch_get_cpu_cycle_count();
+uint32_t arch_get_cpu_freq_hz();
+
+namespace gpio {
+enum Flags { FLAG_NONE = 0, FLAG_INPUT = 1, FLAG_OUTPUT = 2 };
+}  // namespace gpio
+
+/// Writes are recorded with their time, see host::pin_edges()
+class ISRInternalGPIOPin {
+ public:
+  void digital_write(bool value);
+};
+
+class GPIOPin {
+ public:
+  virtual void setup() = 0;
+  virtual void pin_mode(gpio::Flags flags) {}
+  virtual bool digital_read() = 0;
+  virtual void digital_write(bool value) = 0;
+  virtual std::string dump_summary() const { return ""; }
+  virtual bool is_internal() { return false; }
+};
+
+class InternalGPIOPin : public GPIOPin {
+ public:
+  bool is_internal() override { return true; }
+  virtual uint8_t get_pin() const = 0;
+  virtual bool is_inverted() const = 0;
+  virtual ISRInternalGPIOPin to_isr() const = 0;
+};
+
+}  // namespace esphome
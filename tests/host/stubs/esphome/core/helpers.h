@@ -0,0 +1,72 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include "optional.h"
+
+#define YESNO(b) ((b) ? "YES" : "NO")
+
+namespace esphome {
+
+inline uint8_t reverse_bits(uint8_t x) {
+  x = ((x & 0xAA) >> 1) | ((x & 0x55) << 1);
+  x = ((x & 0xCC) >> 2) | ((x & 0x33) << 2);
+  return (x >> 4) | (x << 4);
+}
+
+inline std::string format_hex_pretty(const uint8_t *data, size_t length) {
+  std::string ret;
+  char buf[4];
+  for (size_t i = 0; i < length; i++) {
+    snprintf(buf, sizeof(buf), i == 0 ? "%02X" : ".%02X", data[i]);
+    ret += buf;
+  }
+  if (length > 4)
+    ret += " (" + std::to_string(length) + ")";
+  return ret;
+}
+inline std::string format_hex_pretty(const std::vector<uint8_t> &data) {
+  return format_hex_pretty(data.data(), data.size());
+}
+
+template<typename T> T clamp(T v, T lo, T hi) { return std::min(std::max(v, lo), hi); }
+
+template<typename T, typename... Args> std::unique_ptr<T> make_unique(Args &&...args) {
+  return std::unique_ptr<T>(new T(std::forward<Args>(args)...));
+}
+
+uint32_t random_uint32();
+float random_float();
+
+class InterruptLock {
+ public:
+  InterruptLock() {}
+  ~InterruptLock() {}
+};
+
+template<class T> class RAMAllocator {
+ public:
+  enum Flags { NONE = 0, ALLOW_FAILURE = 1 };
+  RAMAllocator(Flags flags = NONE) {}
+  T *allocate(size_t n) { return static_cast<T *>(malloc(n * sizeof(T))); }
+  void deallocate(T *p, size_t n) { free(p); }
+};
+template<class T> using ExternalRAMAllocator = RAMAllocator<T>;
+
+template<typename T> class Parented {
+ public:
+  Parented() {}
+  Parented(T *parent) : parent_(parent) {}
+  T *get_parent() const { return this->parent_; }
+  void set_parent(T *parent) { this->parent_ = parent; }
+
+ protected:
+  T *parent_{nullptr};
+};
+
+}  // namespace esphome
@@ -0,0 +1,9 @@
+#pragma once
+#include <optional>
+
+namespace esphome {
+
+template<typename T> using optional = std::optional<T>;
+using std::nullopt;
+
+}  // namespace esphome
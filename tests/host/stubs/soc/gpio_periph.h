@@ -0,0 +1,10 @@
+#pragma once
+#include <cstdint>
+
+struct gpio_pin_reg_t {
+  uint32_t pad_driver;
+};
+struct gpio_dev_t {
+  gpio_pin_reg_t pin[40];
+};
+extern gpio_dev_t GPIO;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -0,0 +1,108 @@
+// Once its buffers have grown to the frames it gets, a receiver decodes, triggers and dumps without touching the heap
+#include "host.h"
+#include "fake_receiver.h"
+#include "esphome/components/remote_base/aeha_protocol.h"
+#include "esphome/components/remote_base/haier_protocol.h"
+#include "esphome/components/remote_base/nec_protocol.h"
+#include "esphome/components/remote_base/pronto_protocol.h"
+#include "esphome/components/remote_base/raw_protocol.h"
+
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+static bool counting = false;
+static uint32_t allocations = 0;
+
+void *operator new(size_t size) {
+  if (counting)
+    allocations++;
+  void *ptr = malloc(size == 0 ? 1 : size);
+  if (ptr == nullptr)
+    throw std::bad_alloc();
+  return ptr;
+}
+__attribute__((noinline)) void operator delete(void *ptr) noexcept { free(ptr); }
+__attribute__((noinline)) void operator delete(void *ptr, size_t /*size*/) noexcept { free(ptr); }
+
+using namespace esphome::remote_base;
+
+template<typename T, typename D> static RawTimings frame(const D &data) {
+  RemoteTransmitData encoded;
+  T().encode(&encoded, data);
+  RawTimings timings = encoded.get_data();
+  timings.push_back(-40000);
+  return timings;
+}
+
+int main() {
+  // the count works
+  counting = true;
+  ::operator delete(::operator new(4));
+  counting = false;
+  CHECK(allocations == 1);
+  allocations = 0;
+
+  const std::vector<RawTimings> frames = {
+      frame<NECProtocol>(NECData{0x1234, 0x5678}),
+      frame<AEHAProtocol>(AEHAData{0x2002, {0x80, 0x00, 0x00, 0x06, 0x60}}),
+      frame<NECProtocol>(NECData{0x1234, 0x9ABC}),
+      // the same again, replayed from the fingerprint cache
+      frame<NECProtocol>(NECData{0x1234, 0x9ABC}),
+      {1000, -1000, 1000, -40000},
+  };
+
+  host::FakeReceiver receiver;
+  receiver.set_fingerprint_timeout(1000);
+  RemoteReceiverDispatch<ProntoDispatcher<0, 1>, NECDispatcher<1, 1>, AEHADispatcher<0, 1>> dispatch;
+  NECBinarySensor power;
+  power.set_data({0x1234, 0x5678});
+  esphome::Trigger<const ProntoData &> pronto_trigger;
+  esphome::Trigger<const NECData &> nec_trigger;
+  esphome::Trigger<const AEHAData &> aeha_trigger;
+  uint32_t triggered = 0;
+  pronto_trigger.add_callback([&](const ProntoData &data) { triggered += !data.data.empty(); });
+  nec_trigger.add_callback([&](const NECData &data) { triggered++; });
+  aeha_trigger.add_callback([&](const AEHAData &data) { triggered++; });
+  dispatch.get<0>()->add_trigger(&pronto_trigger);
+  dispatch.get<1>()->add_binary_sensor(&power);
+  dispatch.get<1>()->add_trigger(&nec_trigger);
+  dispatch.get<2>()->add_trigger(&aeha_trigger);
+  receiver.register_listener(&dispatch);
+  RawTrigger raw_trigger;
+  uint32_t raw_timings = 0;
+  raw_trigger.add_callback([&](const RawTimings &timings) { raw_timings += timings.size(); });
+  receiver.register_listener(&raw_trigger);
+  // Pronto, NEC and AEHA dumpers share the decodes of the dispatch, Haier and Raw ones decode on their own
+  ProntoDumper pronto_dumper;
+  NECDumper nec_dumper;
+  AEHADumper aeha_dumper;
+  HaierDumper haier_dumper;
+  RawDumper raw_dumper;
+  for (RemoteReceiverDumperBase *dumper : std::vector<RemoteReceiverDumperBase *>{
+           &pronto_dumper, &nec_dumper, &aeha_dumper, &haier_dumper, &raw_dumper})
+    receiver.register_dumper(dumper);
+
+  // the decode buffers take turns, so both need to have seen every frame before they stop growing
+  for (int pass = 0; pass < 2; pass++) {
+    for (const auto &timings : frames)
+      receiver.receive(timings);
+  }
+  triggered = 0;
+  raw_timings = 0;
+
+  counting = true;
+  for (int pass = 0; pass < 10; pass++) {
+    for (const auto &timings : frames)
+      receiver.receive(timings);
+  }
+  counting = false;
+
+  if (!CHECK(allocations == 0))
+    printf("  %u allocations in 50 frames\n", (unsigned) allocations);
+  // Pronto takes every frame, NEC three and AEHA one of each pass
+  CHECK(triggered == 10 * (5 + 3 + 1));
+  CHECK(raw_timings != 0);
+  CHECK(receiver.get_fingerprint_hits() != 0);
+  return host::failures();
+}
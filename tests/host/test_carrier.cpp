@@ -0,0 +1,101 @@
+// estimate_carrier_frequency() and collapse_carrier() on synthetic non-demodulated captures, and the carrier
+// frequency receivers hand to decoders
+#include "host.h"
+#include "fake_receiver.h"
+#include "esphome/components/remote_base/remote_base.h"
+
+#include <cstdlib>
+
+using namespace esphome::remote_base;
+
+/// A capture of marks modulated at carrier_frequency with duty percent, as a receiver without demodulator sees it
+static RawTimings modulate(const std::vector<int32_t> &frame, uint32_t carrier_frequency, uint32_t duty) {
+  RawTimings data;
+  const double period = 1e6 / carrier_frequency;
+  for (int32_t value : frame) {
+    if (value < 0) {
+      data.push_back(value);
+      continue;
+    }
+    // whole carrier periods, each split into a pulse and the space up to the next one
+    const int pulses = std::max<int>(1, int(value / period + 0.5));
+    double t = 0;
+    for (int i = 0; i < pulses; i++) {
+      const int32_t on = std::max<int32_t>(1, int32_t(t + period * duty / 100 + 0.5) - int32_t(t + 0.5));
+      data.push_back(on);
+      t += period;
+      if (i + 1 < pulses)
+        data.push_back(-(std::max<int32_t>(1, int32_t(t + 0.5) - int32_t(t - period + 0.5) - on)));
+    }
+  }
+  return data;
+}
+
+static void test_estimate(uint32_t carrier_frequency) {
+  const std::vector<int32_t> frame = {9000, -4500, 560, -560, 560, -1690, 560, -1690, 560, -560, 560, -40000};
+  for (uint32_t duty : {25u, 33u, 50u}) {
+    RawTimings data = modulate(frame, carrier_frequency, duty);
+    const uint32_t estimate = estimate_carrier_frequency(data);
+    CHECK(std::abs(int32_t(estimate) - int32_t(carrier_frequency)) <= int32_t(carrier_frequency / 50));
+
+    collapse_carrier(data, estimate);
+    CHECK(data.size() == frame.size());
+    if (data.size() != frame.size())
+      continue;
+    for (size_t i = 0; i < frame.size(); i++) {
+      // marks are sent as whole carrier periods and a collapsed one ends with its last pulse, so it may be up to two
+      // periods off
+      CHECK(std::abs(data[i] - frame[i]) <= int32_t(2000000 / carrier_frequency) + 1);
+    }
+  }
+}
+
+static void test_demodulated() {
+  // a demodulated frame has no carrier to find, and must not be changed
+  const RawTimings frame = {9000, -4500, 560, -560, 560, -1690, 560, -1690, 560, -40000};
+  CHECK(estimate_carrier_frequency(frame) == 0);
+  RawTimings data = frame;
+  collapse_carrier(data, 0);
+  CHECK(data == frame);
+  CHECK(estimate_carrier_frequency({}) == 0);
+}
+
+/// Records the carrier frequency of the frames it's handed
+class CarrierListener : public RemoteReceiverListener {
+ public:
+  bool on_receive(RemoteReceiveData data) override {
+    this->carrier_frequency = data.get_carrier_frequency();
+    return true;
+  }
+
+  uint32_t carrier_frequency{0};
+};
+
+static void test_receiver_hint() {
+  const std::vector<int32_t> frame = {9000, -4500, 560, -560, 560, -1690, 560, -1690, 560, -560, 560, -40000};
+  host::FakeReceiver receiver;
+  CarrierListener listener;
+  receiver.register_listener(&listener);
+  receiver.receive(frame);
+  CHECK(listener.carrier_frequency == 0);
+
+  // the hint is what decoders get for demodulated frames
+  receiver.set_carrier_frequency(36000);
+  receiver.receive(frame);
+  CHECK(listener.carrier_frequency == 36000);
+
+  // a measured carrier wins over it
+  receiver.set_detect_carrier(true);
+  receiver.receive(modulate(frame, 40000, 33));
+  CHECK(std::abs(int32_t(listener.carrier_frequency) - 40000) <= 800);
+  receiver.receive(frame);
+  CHECK(listener.carrier_frequency == 36000);
+}
+
+int main() {
+  for (uint32_t carrier_frequency : {30000u, 36000u, 38000u, 40000u, 56000u})
+    test_estimate(carrier_frequency);
+  test_demodulated();
+  test_receiver_hint();
+  return host::failures();
+}
@@ -0,0 +1,148 @@
+// Dispatchers decode each frame once for all binary sensors, triggers and the dumper of their protocol
+#include "host.h"
+#include "fake_receiver.h"
+#include "esphome/components/remote_base/nec_protocol.h"
+#include "esphome/components/remote_base/sony_protocol.h"
+
+using namespace esphome::remote_base;
+
+using CountingNEC = host::CountingProtocol<NECProtocol, NECData>;
+using Dispatcher = RemoteReceiverDispatcher<CountingNEC, NECData, 0, 1>;
+using Dumper = RemoteReceiverDumper<CountingNEC, NECData>;
+
+static RawTimings nec_frame(uint16_t address, uint16_t command) {
+  RemoteTransmitData data;
+  NECProtocol().encode(&data, {address, command});
+  RawTimings timings = data.get_data();
+  timings.push_back(-40000);
+  return timings;
+}
+
+static void reset() {
+  CountingNEC::decodes = 0;
+  CountingNEC::dumps = 0;
+}
+
+static void test_shared_decode(bool dumper_first) {
+  reset();
+  host::FakeReceiver receiver;
+  Dispatcher dispatcher;
+  Dumper dumper;
+  esphome::Trigger<const NECData &> trigger;
+  uint32_t triggered = 0;
+  trigger.add_callback([&](const NECData &data) { triggered++; });
+  dispatcher.add_trigger(&trigger);
+  // registration order depends on the config, so both have to link the dumper to the dispatcher
+  if (dumper_first) {
+    receiver.register_dumper(&dumper);
+    receiver.register_listener(&dispatcher);
+  } else {
+    receiver.register_listener(&dispatcher);
+    receiver.register_dumper(&dumper);
+  }
+
+  receiver.receive(nec_frame(0x1234, 0x5678));
+  CHECK(triggered == 1);
+  CHECK(CountingNEC::dumps == 1);
+  CHECK(CountingNEC::decodes == 1);
+
+  // a frame that isn't NEC is tried once too
+  receiver.receive({1000, -1000, 1000, -40000});
+  CHECK(CountingNEC::decodes == 2);
+  CHECK(CountingNEC::dumps == 1);
+
+  // another frame must not get the result of the last one
+  receiver.receive(nec_frame(0x1234, 0x5678));
+  CHECK(CountingNEC::decodes == 3);
+  CHECK(CountingNEC::dumps == 2);
+}
+
+static void test_dumper_alone() {
+  reset();
+  host::FakeReceiver receiver;
+  Dumper dumper;
+  receiver.register_dumper(&dumper);
+  receiver.receive(nec_frame(0x1, 0x2));
+  CHECK(CountingNEC::decodes == 1);
+  CHECK(CountingNEC::dumps == 1);
+}
+
+static void test_fingerprint_replay() {
+  reset();
+  host::FakeReceiver receiver;
+  receiver.set_fingerprint_timeout(1000);
+  Dispatcher dispatcher;
+  Dumper dumper;
+  esphome::Trigger<const NECData &> trigger;
+  NECData last{};
+  uint32_t triggered = 0;
+  trigger.add_callback([&](const NECData &data) {
+    last = data;
+    triggered++;
+  });
+  dispatcher.add_trigger(&trigger);
+  receiver.register_listener(&dispatcher);
+  receiver.register_dumper(&dumper);
+
+  receiver.receive(nec_frame(0xABCD, 0x00FF));
+  receiver.receive(nec_frame(0xABCD, 0x00FF));
+  // the repeat is emitted and dumped from the kept result, without decoding
+  CHECK(triggered == 2);
+  CHECK(last == (NECData{0xABCD, 0x00FF}));
+  CHECK(CountingNEC::dumps == 2);
+  CHECK(CountingNEC::decodes == 1);
+  CHECK(receiver.get_fingerprint_hits() == 1);
+}
+
+static void test_receiver_dispatch() {
+  // what codegen generates for a receiver with two NEC binary sensors, an NEC trigger and a Sony trigger
+  reset();
+  host::FakeReceiver receiver;
+  receiver.set_fingerprint_timeout(1000);
+  RemoteReceiverDispatch<RemoteReceiverDispatcher<CountingNEC, NECData, 2, 1>, SonyDispatcher<0, 1>> dispatch;
+  RemoteReceiverBinarySensor<CountingNEC, NECData> power;
+  RemoteReceiverBinarySensor<CountingNEC, NECData> mute;
+  power.set_data({0x1234, 0x5678});
+  mute.set_data({0x1234, 0x9ABC});
+  esphome::Trigger<const NECData &> nec_trigger;
+  esphome::Trigger<const SonyData &> sony_trigger;
+  uint32_t nec_triggered = 0;
+  uint32_t sony_triggered = 0;
+  nec_trigger.add_callback([&](const NECData &data) { nec_triggered++; });
+  sony_trigger.add_callback([&](const SonyData &data) { sony_triggered++; });
+  dispatch.get<0>()->add_binary_sensor(&power);
+  dispatch.get<0>()->add_binary_sensor(&mute);
+  dispatch.get<0>()->add_trigger(&nec_trigger);
+  dispatch.get<1>()->add_trigger(&sony_trigger);
+  receiver.register_listener(&dispatch);
+  Dumper dumper;
+  receiver.register_dumper(&dumper);
+
+  receiver.receive(nec_frame(0x1234, 0x5678));
+  CHECK(nec_triggered == 1 && sony_triggered == 0);
+  CHECK(power.publishes == 2 && mute.publishes == 0);
+  CHECK(CountingNEC::decodes == 1 && CountingNEC::dumps == 1);
+
+  // the repeat goes to the NEC dispatcher only, from its kept result
+  receiver.receive(nec_frame(0x1234, 0x5678));
+  CHECK(nec_triggered == 2 && sony_triggered == 0);
+  CHECK(power.publishes == 4 && mute.publishes == 0);
+  CHECK(CountingNEC::decodes == 1 && CountingNEC::dumps == 2);
+
+  RemoteTransmitData sony;
+  SonyProtocol().encode(&sony, {0xA90, 12});
+  RawTimings timings = sony.get_data();
+  timings.push_back(-40000);
+  receiver.receive(timings);
+  CHECK(nec_triggered == 2 && sony_triggered == 1);
+  CHECK(CountingNEC::decodes == 2);
+}
+
+int main() {
+  test_shared_decode(false);
+  test_shared_decode(true);
+  test_dumper_alone();
+  test_fingerprint_replay();
+  test_receiver_dispatch();
+  return host::failures();
+}
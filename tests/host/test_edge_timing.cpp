@@ -0,0 +1,169 @@
+// Edge timing of the bit-banged transmit loop (ESP8266/LibreTiny) on a simulated clock, next to the loop it replaced,
+// which drove the pin through the virtual GPIOPin interface and fed the watchdog after every mark and space.
+//
+// Cost model, in simulated µs: every micros() call 1, every pin write 1, a virtual GPIOPin call on top of that 1, and
+// App.feed_wdt() FEED_WDT_COST. Errors are measured against edges laid out on an ideal clock.
+#include "host.h"
+#include "fake_pin.h"
+#include "esphome/components/remote_base/nec_protocol.h"
+#include "esphome/components/remote_transmitter/remote_transmitter.h"
+
+#include <cinttypes>
+#include <cmath>
+#include <map>
+
+using namespace esphome;
+using namespace esphome::remote_base;
+
+static const uint32_t CARRIER_FREQUENCY = 38000;
+static const uint32_t FEED_WDT_COST = 3;
+static const uint32_t VIRTUAL_CALL_COST = 1;
+
+/// The transmit loop before the edge schedule, as it was in remote_transmitter_libretiny.cpp
+class LegacyTransmitter {
+ public:
+  explicit LegacyTransmitter(GPIOPin *pin) : pin_(pin) {}
+  void send(const RawTimings &data, uint32_t on_time, uint32_t off_time) {
+    this->target_time_ = 0;
+    for (int32_t item : data) {
+      if (item > 0) {
+        this->mark_(on_time, off_time, item);
+      } else {
+        this->space_(-item);
+      }
+      host::advance_micros(FEED_WDT_COST);
+    }
+    this->await_target_time_();
+    this->pin_->digital_write(false);
+  }
+
+ protected:
+  void await_target_time_() {
+    const uint32_t current_time = micros();
+    if (this->target_time_ == 0) {
+      this->target_time_ = current_time;
+    } else {
+      while (this->target_time_ > micros()) {
+      }
+    }
+  }
+  void mark_(uint32_t on_time, uint32_t off_time, uint32_t usec) {
+    this->await_target_time_();
+    this->pin_->digital_write(true);
+    const uint32_t target = this->target_time_ + usec;
+    while (true) {
+      this->target_time_ += on_time;
+      if (this->target_time_ >= target)
+        break;
+      this->await_target_time_();
+      this->pin_->digital_write(false);
+      this->target_time_ += off_time;
+      if (this->target_time_ >= target)
+        break;
+      this->await_target_time_();
+      this->pin_->digital_write(true);
+    }
+    this->target_time_ = target;
+  }
+  void space_(uint32_t usec) {
+    this->await_target_time_();
+    this->pin_->digital_write(false);
+    this->target_time_ += usec;
+  }
+
+  GPIOPin *pin_;
+  uint32_t target_time_{0};
+};
+
+/// Edges of data on an ideal clock, starting at start
+static std::vector<host::PinEdge> ideal_edges(const RawTimings &data, uint32_t on_time, uint32_t off_time,
+                                              uint32_t start) {
+  std::vector<host::PinEdge> edges;
+  uint32_t time = start;
+  for (int32_t item : data) {
+    const uint32_t end = time + std::abs(item);
+    edges.push_back({time, item > 0});
+    if (item > 0) {
+      for (uint32_t edge = time + on_time; edge < end;) {
+        edges.push_back({edge, false});
+        edge += off_time;
+        if (edge >= end)
+          break;
+        edges.push_back({edge, true});
+        edge += on_time;
+      }
+    }
+    time = end;
+  }
+  edges.push_back({time, false});
+  return edges;
+}
+
+struct EdgeError {
+  uint32_t max;
+  double mean;
+  int32_t last_edge;
+};
+
+/// Error of each edge against ideal, after shifting ideal by the offset most edges have (the start latency)
+static EdgeError measure(const std::vector<host::PinEdge> &edges, const std::vector<host::PinEdge> &ideal) {
+  EdgeError error{0, 0.0, 0};
+  CHECK(edges.size() == ideal.size());
+  const size_t count = std::min(edges.size(), ideal.size());
+  if (count == 0)
+    return error;
+  std::map<int32_t, size_t> offsets;
+  for (size_t i = 0; i < count; i++) {
+    CHECK(edges[i].level == ideal[i].level);
+    offsets[int32_t(edges[i].time - ideal[i].time)]++;
+  }
+  const int32_t latency =
+      std::max_element(offsets.begin(), offsets.end(), [](const auto &a, const auto &b) { return a.second < b.second; })
+          ->first;
+  for (size_t i = 0; i < count; i++) {
+    const uint32_t e = std::abs(int32_t(edges[i].time - ideal[i].time) - latency);
+    error.max = std::max(error.max, e);
+    error.mean += e;
+  }
+  error.mean /= count;
+  error.last_edge = int32_t(edges[count - 1].time - ideal[count - 1].time) - latency;
+  return error;
+}
+
+int main() {
+  host::set_simulated_clock(true, 1);
+  host::set_pin_write_cost(1);
+  host::advance_micros(1000);
+
+  RemoteTransmitData frame;
+  NECProtocol().encode(&frame, {0x1234, 0x5678});
+  const uint32_t period = (1000000 + CARRIER_FREQUENCY / 2) / CARRIER_FREQUENCY;
+  const uint32_t on_time = period / 2, off_time = period - on_time;
+
+  host::FakePin pin(4, VIRTUAL_CALL_COST);
+  host::pin_edges().clear();
+  LegacyTransmitter(&pin).send(frame.get_data(), on_time, off_time);
+  const auto legacy_edges = host::pin_edges();
+  const EdgeError legacy =
+      measure(legacy_edges, ideal_edges(frame.get_data(), on_time, off_time, legacy_edges.front().time));
+
+  remote_transmitter::RemoteTransmitterComponent transmitter(&pin);
+  transmitter.setup();
+  host::pin_edges().clear();
+  auto call = transmitter.transmit();
+  call.get_data()->set_data(frame.get_data());
+  call.get_data()->set_carrier_frequency(CARRIER_FREQUENCY);
+  call.perform();
+  const auto edges = host::pin_edges();
+  const EdgeError current = measure(edges, ideal_edges(frame.get_data(), on_time, off_time, edges.front().time));
+
+  printf("NEC frame at %" PRIu32 " Hz, %zu edges:\n", CARRIER_FREQUENCY, edges.size());
+  printf("  %-8s max error %3" PRIu32 " us, mean %5.2f us, last edge %3" PRId32 " us\n", "legacy", legacy.max,
+         legacy.mean, legacy.last_edge);
+  printf("  %-8s max error %3" PRIu32 " us, mean %5.2f us, last edge %3" PRId32 " us\n", "current", current.max,
+         current.mean, current.last_edge);
+  // no edge is off by more than the two micros() calls of one wait, so nothing accumulates over the frame
+  CHECK(current.max <= 2);
+  CHECK(current.max <= legacy.max);
+  return host::failures();
+}
@@ -0,0 +1,147 @@
+// What receivers do to a frame before decoders see it: glitch merging, the noise filter, segmentation on long gaps
+// and fingerprints
+#include "host.h"
+#include "fake_receiver.h"
+#include "esphome/components/remote_base/nec_protocol.h"
+
+#include <vector>
+
+using namespace esphome::remote_base;
+
+static RawTimings nec_frame(uint16_t address, uint16_t command) {
+  RemoteTransmitData data;
+  NECProtocol().encode(&data, {address, command});
+  RawTimings timings = data.get_data();
+  timings.push_back(-40000);
+  return timings;
+}
+
+/// Records the segments it's handed
+class SegmentListener : public RemoteReceiverListener {
+ public:
+  struct Segment {
+    int32_t size;
+    uint32_t repeats;
+    bool nec;
+  };
+
+  bool on_receive(RemoteReceiveData data) override {
+    this->segments.push_back({data.size(), data.get_repeats(), NECProtocol().decode(data).has_value()});
+    return true;
+  }
+
+  std::vector<Segment> segments;
+};
+
+static void test_merge_glitches() {
+  RawTimings data{560, -12, 540, -1690, 560, -560};
+  merge_glitches(data, 50);
+  CHECK((data == RawTimings{1112, -1690, 560, -560}));
+
+  // a glitch that's a mark lengthens the space before it
+  data = {560, -800, 8, -800, 560};
+  merge_glitches(data, 50);
+  CHECK((data == RawTimings{560, -1608, 560}));
+
+  // a timing of the threshold stays, as does a short first one
+  data = {20, -50, 560, -49};
+  merge_glitches(data, 50);
+  CHECK((data == RawTimings{20, -50, 609}));
+
+  // without a threshold only adjacent marks and spaces are joined
+  data = {280, 280, -560, -100, 560};
+  merge_glitches(data, 0);
+  CHECK((data == RawTimings{560, -660, 560}));
+}
+
+static void test_fingerprint_timings() {
+  const RawTimings a{9000, -4500, 560, -560, 560, -1690};
+  // within a quarter octave of a
+  const RawTimings b{9100, -4550, 570, -570, 560, -1700};
+  const RawTimings longer{9000, -4500, 560, -1690, 560, -1690};
+  const RawTimings inverted{-9000, 4500, -560, 560, -560, 1690};
+  const uint32_t fingerprint = fingerprint_timings(a.begin(), a.end());
+  CHECK(fingerprint == fingerprint_timings(b.begin(), b.end()));
+  CHECK(fingerprint != fingerprint_timings(longer.begin(), longer.end()));
+  CHECK(fingerprint != fingerprint_timings(inverted.begin(), inverted.end()));
+  CHECK(fingerprint != fingerprint_timings(a.begin(), a.end() - 1));
+  CHECK(fingerprint_timings(a.begin(), a.begin()) != 0);
+}
+
+static void test_segments() {
+  host::FakeReceiver receiver;
+  receiver.set_segment_gap(20000);
+  SegmentListener listener;
+  receiver.register_listener(&listener);
+
+  // three copies of a frame are one segment with two repeats; the last one needs no gap
+  RawTimings buffer;
+  for (int i = 0; i < 3; i++) {
+    const RawTimings frame = nec_frame(0x1234, 0x5678);
+    buffer.insert(buffer.end(), frame.begin(), frame.end() - (i == 2 ? 1 : 0));
+  }
+  receiver.receive(buffer);
+  CHECK(listener.segments.size() == 1);
+  CHECK(listener.segments[0].repeats == 2);
+  CHECK(listener.segments[0].size == 68);
+  CHECK(listener.segments[0].nec);
+
+  // different frames are decoded one by one
+  listener.segments.clear();
+  buffer = nec_frame(0x1234, 0x5678);
+  const RawTimings other = nec_frame(0x1234, 0x9ABC);
+  buffer.insert(buffer.end(), other.begin(), other.end());
+  receiver.receive(buffer);
+  CHECK(listener.segments.size() == 2 && listener.segments[0].nec && listener.segments[1].nec);
+
+  // without a segment gap the buffer is one frame
+  listener.segments.clear();
+  receiver.set_segment_gap(0);
+  receiver.receive(buffer);
+  CHECK(listener.segments.size() == 1);
+  CHECK(listener.segments[0].size == int32_t(buffer.size()));
+}
+
+static void test_noise_filter() {
+  host::FakeReceiver receiver;
+  SegmentListener listener;
+  receiver.register_listener(&listener);
+  receiver.set_min_frame_timings(8);
+  receiver.set_max_distinct_timings(6);
+
+  receiver.receive({560, -560, 560, -40000});
+  CHECK(receiver.get_noise_frames() == 1);
+  // lengths all over the place
+  receiver.receive({100, -230, 410, -770, 1300, -2500, 4100, -7900, 150, -40000});
+  CHECK(receiver.get_noise_frames() == 2);
+  CHECK(listener.segments.empty());
+
+  receiver.receive(nec_frame(0x1, 0x2));
+  CHECK(receiver.get_noise_frames() == 2);
+  CHECK(listener.segments.size() == 1 && listener.segments[0].nec);
+}
+
+static void test_glitch_threshold() {
+  host::FakeReceiver receiver;
+  SegmentListener listener;
+  receiver.register_listener(&listener);
+  RawTimings frame = nec_frame(0x1234, 0x5678);
+  // split the header mark
+  frame[0] -= 30;
+  frame.insert(frame.begin() + 1, {-15, 15});
+
+  receiver.receive(frame);
+  CHECK(listener.segments.size() == 1 && !listener.segments[0].nec);
+  receiver.set_glitch_threshold(40);
+  receiver.receive(frame);
+  CHECK(listener.segments.size() == 2 && listener.segments[1].nec);
+}
+
+int main() {
+  test_merge_glitches();
+  test_fingerprint_timings();
+  test_segments();
+  test_noise_filter();
+  test_glitch_threshold();
+  return host::failures();
+}
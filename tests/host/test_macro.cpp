@@ -0,0 +1,141 @@
+// Gaps between the frames of a transmit macro are measured from the end of a frame, also when the transmitter sends
+// in the background and perform() returns right away; frames joined without a gap, and macros played again while they
+// wait
+#include "host.h"
+#include "fake_transmitter.h"
+
+#include <cinttypes>
+
+using namespace esphome;
+using namespace esphome::remote_base;
+
+class TimingsAction : public RemoteTransmitterActionBase<> {
+ public:
+  explicit TimingsAction(RawTimings timings) : timings_(std::move(timings)) {}
+
+ protected:
+  void encode(RemoteTransmitData *dst) override { dst->set_data(this->timings_); }
+  RawTimings timings_;
+};
+
+static void run(host::FakeTransmitter &transmitter) {
+  for (int i = 0; i < 1000 && (host::pending_timeouts() != 0 || transmitter.has_pending_frames()); i++) {
+    transmitter.loop();
+    host::run_scheduler();
+    host::advance_micros(1000);
+  }
+}
+
+static void test_gap(bool background) {
+  host::FakeTransmitter transmitter(background);
+  // 30ms frames
+  TimingsAction first({10000, -10000, 10000});
+  TimingsAction second({5000, -5000});
+  first.set_parent(&transmitter);
+  second.set_parent(&transmitter);
+  RemoteTransmitterMacroAction<> macro;
+  macro.set_parent(&transmitter);
+  macro.set_max_inline_gap(10000);
+  macro.add_frame(&first, 50000);
+  macro.add_frame(&second, 0);
+
+  macro.play_complex();
+  run(transmitter);
+  CHECK(transmitter.sent.size() == 2);
+  if (transmitter.sent.size() != 2)
+    return;
+  // the second frame starts 50ms after the first one ended, give or take the scheduler's 1ms resolution
+  const uint32_t gap = transmitter.sent[1].time - transmitter.sent[0].time - 30000;
+  printf("%s transmitter: gap %" PRIu32 " us\n", background ? "background" : "blocking", gap);
+  CHECK(gap >= 50000 && gap <= 52000);
+}
+
+static void test_queued() {
+  // a frame that is queued behind others starts its gap only once it's been sent
+  host::FakeTransmitter transmitter(true);
+  TimingsAction first({10000});
+  TimingsAction second({1000});
+  first.set_parent(&transmitter);
+  second.set_parent(&transmitter);
+  RemoteTransmitterMacroAction<> macro;
+  macro.set_parent(&transmitter);
+  macro.add_frame(&first, 20000);
+  macro.add_frame(&second, 0);
+
+  // a 40ms frame is queued with priority, so the macro's first frame waits behind it
+  auto call = transmitter.transmit();
+  call.get_data()->mark(40000);
+  call.set_priority(1);
+  call.set_coalesce_key(1);
+  call.perform();
+  macro.play_complex();
+  run(transmitter);
+  CHECK(transmitter.sent.size() == 3);
+  if (transmitter.sent.size() != 3)
+    return;
+  const uint32_t gap = transmitter.sent[2].time - transmitter.sent[1].time - 10000;
+  CHECK(gap >= 20000 && gap <= 22000);
+}
+
+static void test_no_gap() {
+  // the default gap of 0 joins the frames without a 0 µs space, which would end an RMT transmission
+  host::FakeTransmitter transmitter(false);
+  TimingsAction first({9000, -4500, 560});
+  TimingsAction second({9000, -4500, 560, -560});
+  TimingsAction third({560});
+  first.set_parent(&transmitter);
+  second.set_parent(&transmitter);
+  third.set_parent(&transmitter);
+  RemoteTransmitterMacroAction<> macro;
+  macro.set_parent(&transmitter);
+  macro.add_frame(&first, 0);
+  macro.add_frame(&second, 0);
+  macro.add_frame(&third, 0);
+
+  macro.play_complex();
+  run(transmitter);
+  CHECK(transmitter.sent.size() == 1);
+  if (transmitter.sent.size() != 1)
+    return;
+  CHECK((transmitter.sent[0].data == RawTimings{9000, -4500, 9560, -4500, 560, -560, 560}));
+  CHECK(!macro.is_running());
+}
+
+static void test_replay() {
+  host::FakeTransmitter transmitter(false);
+  TimingsAction first({10000});
+  TimingsAction second({1000});
+  first.set_parent(&transmitter);
+  second.set_parent(&transmitter);
+  RemoteTransmitterMacroAction<> macro;
+  macro.set_parent(&transmitter);
+  macro.add_frame(&first, 100000);
+  macro.add_frame(&second, 0);
+
+  // played again while waiting for the gap, the macro starts over and finishes once
+  macro.play_complex();
+  CHECK(macro.is_running());
+  macro.play_complex();
+  run(transmitter);
+  CHECK(transmitter.sent.size() == 3);
+  CHECK(!macro.is_running());
+
+  // stopped while waiting, it's not running any more and sends nothing else
+  transmitter.sent.clear();
+  macro.play_complex();
+  macro.stop_complex();
+  CHECK(!macro.is_running());
+  run(transmitter);
+  CHECK(transmitter.sent.size() == 1);
+}
+
+int main() {
+  host::set_simulated_clock(true);
+  host::advance_micros(1000000);
+  test_gap(true);
+  test_gap(false);
+  test_queued();
+  test_no_gap();
+  test_replay();
+  return host::failures();
+}
@@ -0,0 +1,64 @@
+// Fixed-size payloads report what doesn't fit, and AEHA and Haier refuse to send truncated data
+#include "host.h"
+#include "fake_transmitter.h"
+#include "esphome/components/remote_base/aeha_protocol.h"
+#include "esphome/components/remote_base/haier_protocol.h"
+
+#include <vector>
+
+using namespace esphome::remote_base;
+
+static void test_static_vector() {
+  StaticVector<uint8_t, 2> values;
+  CHECK(values.push_back(1));
+  CHECK(values.push_back(2));
+  CHECK(!values.overflowed());
+  CHECK(!values.push_back(3));
+  CHECK(values.overflowed());
+  CHECK(values.size() == 2);
+  values.clear();
+  CHECK(!values.overflowed());
+
+  const StaticVector<uint8_t, 2> from_vector(std::vector<uint8_t>{1, 2, 3});
+  CHECK(from_vector.overflowed());
+  CHECK(from_vector.size() == 2);
+  // copies keep the flag, assignments reset it
+  StaticVector<uint8_t, 2> copy = from_vector;
+  CHECK(copy.overflowed());
+  copy = {1};
+  CHECK(!copy.overflowed());
+}
+
+static void test_aeha() {
+  host::FakeTransmitter transmitter(false);
+  AEHAAction<> action;
+  action.set_parent(&transmitter);
+  action.set_address(0x2002);
+  action.set_data([]() { return std::vector<uint8_t>(AEHA_MAX_DATA_BYTES, 0x55); });
+  action.play();
+  CHECK(transmitter.sent.size() == 1);
+
+  action.set_data([]() { return std::vector<uint8_t>(AEHA_MAX_DATA_BYTES + 1, 0x55); });
+  action.play();
+  CHECK(transmitter.sent.size() == 1);
+}
+
+static void test_haier() {
+  host::FakeTransmitter transmitter(false);
+  HaierAction<> action;
+  action.set_parent(&transmitter);
+  action.set_data([]() { return std::vector<uint8_t>(HAIER_MAX_DATA_BYTES, 0xA6); });
+  action.play();
+  CHECK(transmitter.sent.size() == 1);
+
+  action.set_data([]() { return std::vector<uint8_t>(HAIER_MAX_DATA_BYTES + 1, 0xA6); });
+  action.play();
+  CHECK(transmitter.sent.size() == 1);
+}
+
+int main() {
+  test_static_vector();
+  test_aeha();
+  test_haier();
+  return host::failures();
+}
@@ -0,0 +1,83 @@
+// Streaming transmission on ESP32: the translator the RMT driver calls to refill channel memory must produce the same
+// items as encoding the whole frame up front, however the frame falls across refills.
+#include "host.h"
+#include "fake_pin.h"
+#include "esphome/components/remote_transmitter/remote_transmitter.h"
+
+using namespace esphome;
+using namespace esphome::remote_base;
+using remote_transmitter::RemoteTransmitterComponent;
+
+static bool same_items(const std::vector<rmt_item32_t> &a, const std::vector<rmt_item32_t> &b) {
+  if (a.size() != b.size())
+    return false;
+  for (size_t i = 0; i < a.size(); i++) {
+    if (a[i].val != b[i].val)
+      return false;
+  }
+  return true;
+}
+
+static RawTimings long_frame(size_t timings) {
+  RawTimings data;
+  for (size_t i = 0; i < timings; i++)
+    data.push_back(i % 2 == 0 ? int32_t(300 + i % 7 * 100) : -int32_t(500 + i % 5 * 200));
+  return data;
+}
+
+static void send(RemoteTransmitterComponent &transmitter, const RawTimings &data, uint32_t send_times,
+                 uint32_t send_wait) {
+  auto &channel = host::rmt_channel(transmitter.get_channel());
+  channel.items.clear();
+  channel.refills.clear();
+  auto call = transmitter.transmit();
+  call.get_data()->set_data(data);
+  call.set_send_times(send_times);
+  call.set_send_wait(send_wait);
+  call.perform();
+}
+
+int main() {
+  host::FakePin pin;
+  RemoteTransmitterComponent streamed(&pin);
+  streamed.set_streaming(true);
+  RemoteTransmitterComponent buffered(&pin);
+  // both fit into one memory block, so every frame of more than 64 items needs refills
+  streamed.setup();
+  buffered.setup();
+
+  struct Case {
+    const char *name;
+    RawTimings data;
+    uint32_t send_times;
+    uint32_t send_wait;
+  };
+  const Case cases[] = {
+      {"short", {9000, -4500, 560, -560, 560}, 1, 0},
+      {"odd timings", {560, -560, 560}, 1, 0},
+      {"one block", long_frame(128), 1, 0},
+      {"many blocks", long_frame(1001), 1, 0},
+      {"timings over 32767 ticks", {100000, -70000, 560, -200000, 32767, -32768, 65534}, 1, 0},
+      {"repeats", long_frame(99), 3, 25000},
+      {"repeats without wait", long_frame(99), 3, 0},
+      {"repeats with a long wait", {560, -560, 560}, 4, 100000},
+  };
+  for (const auto &c : cases) {
+    send(streamed, c.data, c.send_times, c.send_wait);
+    const auto &streamed_channel = host::rmt_channel(streamed.get_channel());
+    const std::vector<rmt_item32_t> streamed_items = streamed_channel.items;
+    const std::vector<size_t> refills = streamed_channel.refills;
+    send(buffered, c.data, c.send_times, c.send_wait);
+    const auto &buffered_items = host::rmt_channel(buffered.get_channel()).items;
+
+    const bool same = same_items(streamed_items, buffered_items);
+    if (!CHECK(same))
+      printf("  %s: %zu items streamed, %zu buffered\n", c.name, streamed_items.size(), buffered_items.size());
+    // each refill fills at most the part of memory the driver asked for
+    const size_t block = streamed_channel.mem_block_num * SOC_RMT_MEM_WORDS_PER_CHANNEL;
+    for (size_t i = 0; i < refills.size(); i++)
+      CHECK(refills[i] <= (i == 0 ? block : block / 2));
+    printf("%-26s %5zu items in %3zu refills\n", c.name, streamed_items.size(), refills.size());
+  }
+  return host::failures();
+}
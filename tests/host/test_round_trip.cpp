@@ -0,0 +1,90 @@
+// Every protocol decodes what it encodes, also through the jitter and glitches of remote_base.round_trip
+#include "host.h"
+#include "corpus.h"
+
+#include <cinttypes>
+#include <cstdio>
+
+using namespace esphome::remote_base;
+
+static const uint8_t TOLERANCE = 25;
+
+static void test_decodes_own_frames() {
+  for (const auto &sample : host::samples()) {
+    if (!sample.lossy && !CHECK(sample.decodes(RemoteReceiveData(sample.timings(), TOLERANCE))))
+      printf("  %s doesn't decode to what it encoded\n", sample.name);
+  }
+}
+
+static void test_round_trip(uint32_t jitter, uint8_t tolerance, uint8_t glitch_probability, uint32_t min_percent) {
+  const uint32_t iterations = 200;
+  RemoteRoundTrip round_trip;
+  round_trip.set_glitch_probability(glitch_probability);
+  RawTimings disturbed;
+  for (const auto &sample : host::samples()) {
+    RemoteTransmitData clean;
+    sample.encode(&clean);
+    const RawTimings expected = sample.timings();
+    uint32_t successes = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+      round_trip.disturb(clean.get_data(), jitter, sample.inverted, &disturbed);
+      if (sample.round_trips(RemoteReceiveData(disturbed, tolerance), expected))
+        successes++;
+    }
+    if (!CHECK(successes * 100 >= min_percent * iterations))
+      printf("  %s: %" PRIu32 "%% at %" PRIu32 "us jitter\n", sample.name, successes * 100 / iterations, jitter);
+  }
+}
+
+static void test_pronto_needs_tolerance() {
+  // Pronto's data is the received timings less its mark excess compensation, so re-encoding it never gives exactly
+  // the captured frame back
+  for (const auto &sample : host::samples()) {
+    if (!sample.lossy)
+      continue;
+    const RawTimings timings = sample.timings();
+    RemoteTransmitData encoded;
+    ProntoProtocol().encode(&encoded, *ProntoProtocol().decode(RemoteReceiveData(timings, TOLERANCE)));
+    RawTimings exact = encoded.get_data();
+    RemoteRoundTrip::capture(&exact, false);
+    CHECK(exact != timings);
+    CHECK(RemoteRoundTrip::timings_match(encoded.get_data(), timings, TOLERANCE));
+    CHECK(sample.round_trips(RemoteReceiveData(timings, TOLERANCE), timings));
+  }
+}
+
+static void test_dish_unit_codes() {
+  // the encoder sends unit codes 1 to 16; remotes for 17 to 32 set the first padding bit as a fifth address bit
+  RemoteTransmitData encoded;
+  DishProtocol().encode(&encoded, DishData{4, 0x12});
+  RawTimings timings = encoded.get_data();
+  // header, 6 command and 4 address items come first
+  timings[2 * (1 + 6 + 4) + 1] = -1700;
+  auto decoded = DishProtocol().decode(RemoteReceiveData(timings, TOLERANCE));
+  CHECK(decoded.has_value() && *decoded == (DishData{20, 0x12}));
+}
+
+static void test_timings_match() {
+  CHECK(RemoteRoundTrip::timings_match({560, -560, 560, -1690}, {560, -560, 560, -1690}, 0));
+  CHECK(RemoteRoundTrip::timings_match({600, -520, 560, -1690}, {560, -560, 560, -1690}, 10));
+  CHECK(!RemoteRoundTrip::timings_match({700, -560, 560, -1690}, {560, -560, 560, -1690}, 10));
+  // the last space runs into the idle gap
+  CHECK(RemoteRoundTrip::timings_match({560, -560, 560, -50000}, {560, -560, 560, -1690}, 10));
+  CHECK(!RemoteRoundTrip::timings_match({560, -50000}, {560, -560, 560, -1690}, 10));
+  // adjacent marks are one
+  CHECK(RemoteRoundTrip::timings_match({280, 280, -560}, {560, -560}, 0));
+  CHECK(!RemoteRoundTrip::timings_match({-560, 560}, {560, -560}, 25));
+}
+
+int main() {
+  test_decodes_own_frames();
+  test_round_trip(0, TOLERANCE, 0, 100);
+  // Nexa sends its marks at 78% of what it receives, close to the usual tolerance
+  test_round_trip(10, 35, 0, 95);
+  // glitches only must not break the checks
+  test_round_trip(0, TOLERANCE, 100, 0);
+  test_pronto_needs_tolerance();
+  test_dish_unit_codes();
+  test_timings_match();
+  return host::failures();
+}
@@ -0,0 +1,74 @@
+// Order in which queued, coalesced and prioritized frames leave the transmitter
+#include "host.h"
+#include "fake_transmitter.h"
+
+using namespace esphome::remote_base;
+
+static void send(host::FakeTransmitter &transmitter, int32_t mark, uint8_t priority, uint32_t coalesce_key = 0) {
+  auto call = transmitter.transmit();
+  call.get_data()->mark(mark);
+  call.set_priority(priority);
+  call.set_coalesce_key(coalesce_key);
+  call.perform();
+}
+
+static void drain(host::FakeTransmitter &transmitter) {
+  for (int i = 0; i < 100 && transmitter.has_pending_frames(); i++) {
+    host::advance_micros(10000);
+    transmitter.loop();
+  }
+}
+
+static std::vector<int32_t> marks(const host::FakeTransmitter &transmitter) {
+  std::vector<int32_t> marks;
+  for (const auto &sent : transmitter.sent)
+    marks.push_back(sent.data.front());
+  return marks;
+}
+
+static void test_same_priority_fifo() {
+  // a frame without coalesce key must not overtake queued frames of its own priority
+  host::FakeTransmitter transmitter;
+  send(transmitter, 1, 0, 0x10);
+  send(transmitter, 2, 0);
+  send(transmitter, 3, 0, 0x20);
+  send(transmitter, 4, 0);
+  CHECK(transmitter.sent.empty());
+  drain(transmitter);
+  CHECK(marks(transmitter) == (std::vector<int32_t>{1, 2, 3, 4}));
+}
+
+static void test_priorities() {
+  host::FakeTransmitter transmitter;
+  send(transmitter, 1, 1, 0x10);
+  send(transmitter, 2, 0);  // lower than what's waiting: queued behind it
+  send(transmitter, 3, 2);  // higher: goes out right away
+  send(transmitter, 4, 1);  // same as the head of the queue: queued behind it, ahead of the lower one
+  drain(transmitter);
+  CHECK(marks(transmitter) == (std::vector<int32_t>{3, 1, 4, 2}));
+}
+
+static void test_coalesce() {
+  host::FakeTransmitter transmitter;
+  send(transmitter, 1, 0, 0x10);
+  send(transmitter, 2, 0, 0x20);
+  send(transmitter, 3, 0, 0x10);  // replaces the first one, keeping its place
+  drain(transmitter);
+  CHECK(marks(transmitter) == (std::vector<int32_t>{3, 2}));
+}
+
+static void test_empty_queue() {
+  host::FakeTransmitter transmitter;
+  send(transmitter, 1, 0);
+  CHECK(transmitter.sent.size() == 1);
+  CHECK(!transmitter.has_pending_frames());
+}
+
+int main() {
+  host::set_simulated_clock(true);
+  test_same_priority_fifo();
+  test_priorities();
+  test_coalesce();
+  test_empty_queue();
+  return host::failures();
+}
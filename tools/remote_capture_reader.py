@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+# Converts frames captured by the remote_capture component into text, CSV or Pronto.
+#
+# The input is either a device log (for example from "esphome logs"), from which the
+# "CAP " and "CAP+ " lines are picked up, or, with --binary, the raw records back to
+# back. See remote_capture.h for the record format.
+
+import argparse
+import base64
+import re
+import sys
+
+LINE_RE = re.compile(r"\bCAP(\+?) ([A-Za-z0-9+/=]+)")
+# Pronto carrier unit in µs
+PRONTO_CLOCK = 0.241246
+DEFAULT_CARRIER = 38000
+
+
+def read_varint(data, pos):
+    value = 0
+    shift = 0
+    while True:
+        if pos >= len(data):
+            raise ValueError("truncated varint")
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        if not byte & 0x80:
+            return value, pos
+        shift += 7
+
+
+def unzigzag(value):
+    return (value >> 1) ^ -(value & 1)
+
+
+# Splits a byte string into records, returning the bytes of each one without its length
+def split_records(data):
+    pos = 0
+    while pos < len(data):
+        length, pos = read_varint(data, pos)
+        if pos + length > len(data):
+            raise ValueError("truncated record")
+        yield data[pos : pos + length]
+        pos += length
+
+
+# Collects the records of a log, skipping records that lost a continuation line
+def log_records(lines):
+    chunks = None
+    for line in lines:
+        match = LINE_RE.search(line)
+        if match is None:
+            continue
+        if not match.group(1):
+            if chunks is not None:
+                yield from complete_records(chunks)
+            chunks = []
+        elif chunks is None:
+            continue
+        chunks.append(base64.b64decode(match.group(2)))
+    if chunks is not None:
+        yield from complete_records(chunks)
+
+
+def complete_records(chunks):
+    data = b"".join(chunks)
+    try:
+        length, pos = read_varint(data, 0)
+    except ValueError:
+        return
+    if pos + length == len(data):
+        yield data[pos:]
+    else:
+        print(f"skipping incomplete record ({len(data)} bytes)", file=sys.stderr)
+
+
+def parse_record(record):
+    direction = "tx" if record[0] & 1 else "rx"
+    time, pos = read_varint(record, 1)
+    carrier, pos = read_varint(record, pos)
+    timings = []
+    while pos < len(record):
+        value, pos = read_varint(record, pos)
+        timings.append(unzigzag(value))
+    return direction, time, carrier, timings
+
+
+def to_pronto(carrier, timings):
+    carrier = carrier or DEFAULT_CARRIER
+    if timings and timings[0] < 0:
+        timings = timings[1:]
+    if len(timings) % 2:
+        timings = timings + [-100000]
+    words = [0, round(1000000 / (carrier * PRONTO_CLOCK)), 0, len(timings) // 2]
+    words += [max(1, round(abs(t) * carrier / 1000000)) for t in timings]
+    return " ".join(f"{min(word, 0xFFFF):04X}" for word in words)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Convert remote_capture records to text, CSV or Pronto"
+    )
+    parser.add_argument("input", help="device log, or raw records with --binary")
+    parser.add_argument("--binary", action="store_true", help="input is raw records")
+    parser.add_argument("--format", choices=["text", "csv", "pronto"], default="text")
+    args = parser.parse_args()
+
+    if args.binary:
+        with open(args.input, "rb") as file:
+            records = list(split_records(file.read()))
+    else:
+        with open(args.input, encoding="utf-8", errors="replace") as file:
+            records = list(log_records(file))
+
+    if args.format == "csv":
+        print("direction,time_us,carrier_hz,timings")
+    for record in records:
+        direction, time, carrier, timings = parse_record(record)
+        if args.format == "csv":
+            print(f"{direction},{time},{carrier},{' '.join(map(str, timings))}")
+        elif args.format == "pronto":
+            print(to_pronto(carrier, timings))
+        else:
+            print(f"{time / 1000000:.6f} {direction} {carrier} Hz: {timings}")
+
+
+if __name__ == "__main__":
+    main()